@@ -0,0 +1,689 @@
+/**
+ * @file OsqpEigenBenchmark.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+// eigen
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using VectorX = Eigen::Matrix<c_float, Eigen::Dynamic, 1>;
+using SparseMatrix = Eigen::SparseMatrix<c_float>;
+
+/**
+ * Problem contains the matrices and the vectors of a QP problem together with the matrices used
+ * to update it.
+ */
+struct Problem
+{
+    SparseMatrix hessian;
+    SparseMatrix hessianNewValues; /**< Same sparsity pattern of the hessian, different values. */
+    SparseMatrix hessianNewPattern; /**< Hessian with a different sparsity pattern. */
+    SparseMatrix linearMatrix;
+    SparseMatrix linearMatrixNewValues; /**< Same sparsity pattern of linearMatrix. */
+    VectorX gradient;
+    VectorX lowerBound;
+    VectorX upperBound;
+    VectorX lowerBoundNew;
+    VectorX upperBoundNew;
+};
+
+// the pattern change couples the first and the last variable. The added term is
+// epsilon * (e_0 + e_{n-1}) (e_0 + e_{n-1})^T, hence the hessian stays positive semidefinite
+SparseMatrix changeHessianPattern(const SparseMatrix& hessian)
+{
+    constexpr c_float epsilon = 0.01;
+    const int last = static_cast<int>(hessian.cols()) - 1;
+
+    SparseMatrix coupling(hessian.rows(), hessian.cols());
+    std::vector<Eigen::Triplet<c_float>> triplets{{0, 0, epsilon},
+                                                  {last, last, epsilon},
+                                                  {0, last, epsilon},
+                                                  {last, 0, epsilon}};
+    coupling.setFromTriplets(triplets.begin(), triplets.end());
+
+    SparseMatrix hessianNewPattern = hessian + coupling;
+    hessianNewPattern.makeCompressed();
+    return hessianNewPattern;
+}
+
+/**
+ * Build the MPC problem of a double integrator x_{k+1} = [1 dt; 0 1] x_k + [0; dt] u_k.
+ * The problem has 3 * horizon + 2 variables.
+ */
+Problem mpcProblem(int horizon)
+{
+    constexpr int numberOfStates = 2;
+    constexpr c_float samplingTime = 0.1;
+    const int numberOfVariables = numberOfStates * (horizon + 1) + horizon;
+    const int numberOfConstraints = numberOfStates * (horizon + 1) + numberOfVariables;
+
+    Problem problem;
+
+    std::vector<Eigen::Triplet<c_float>> triplets;
+    std::vector<Eigen::Triplet<c_float>> tripletsNewValues;
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        const bool isState = i < numberOfStates * (horizon + 1);
+        triplets.emplace_back(i, i, isState ? 10 : 1);
+        tripletsNewValues.emplace_back(i, i, isState ? 20 : 1);
+    }
+    problem.hessian.resize(numberOfVariables, numberOfVariables);
+    problem.hessian.setFromTriplets(triplets.begin(), triplets.end());
+    problem.hessianNewValues.resize(numberOfVariables, numberOfVariables);
+    problem.hessianNewValues.setFromTriplets(tripletsNewValues.begin(), tripletsNewValues.end());
+    problem.hessianNewPattern = changeHessianPattern(problem.hessian);
+
+    triplets.clear();
+    tripletsNewValues.clear();
+    for (int k = 0; k < numberOfStates * (horizon + 1); k++)
+    {
+        triplets.emplace_back(k, k, -1);
+        tripletsNewValues.emplace_back(k, k, -1);
+    }
+    for (int k = 0; k < horizon; k++)
+    {
+        const int row = numberOfStates * (k + 1);
+        const int state = numberOfStates * k;
+        const int input = numberOfStates * (horizon + 1) + k;
+        triplets.emplace_back(row, state, 1);
+        triplets.emplace_back(row, state + 1, samplingTime);
+        triplets.emplace_back(row + 1, state + 1, 1);
+        triplets.emplace_back(row + 1, input, samplingTime);
+        tripletsNewValues.emplace_back(row, state, 1);
+        tripletsNewValues.emplace_back(row, state + 1, 1.1 * samplingTime);
+        tripletsNewValues.emplace_back(row + 1, state + 1, 1);
+        tripletsNewValues.emplace_back(row + 1, input, 1.1 * samplingTime);
+    }
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        triplets.emplace_back(numberOfStates * (horizon + 1) + i, i, 1);
+        tripletsNewValues.emplace_back(numberOfStates * (horizon + 1) + i, i, 1);
+    }
+    problem.linearMatrix.resize(numberOfConstraints, numberOfVariables);
+    problem.linearMatrix.setFromTriplets(triplets.begin(), triplets.end());
+    problem.linearMatrixNewValues.resize(numberOfConstraints, numberOfVariables);
+    problem.linearMatrixNewValues.setFromTriplets(tripletsNewValues.begin(),
+                                                  tripletsNewValues.end());
+
+    // track the position 1 starting from the origin
+    problem.gradient = VectorX::Zero(numberOfVariables);
+    for (int k = 0; k < horizon + 1; k++)
+    {
+        problem.gradient(numberOfStates * k) = -10;
+    }
+    problem.lowerBound = VectorX::Zero(numberOfConstraints);
+    problem.upperBound = VectorX::Zero(numberOfConstraints);
+    problem.lowerBound.tail(numberOfVariables).setConstant(-10);
+    problem.upperBound.tail(numberOfVariables).setConstant(10);
+
+    // the new bounds move the initial state
+    problem.lowerBoundNew = problem.lowerBound;
+    problem.upperBoundNew = problem.upperBound;
+    problem.lowerBoundNew(0) = problem.upperBoundNew(0) = -0.5;
+
+    return problem;
+}
+
+/**
+ * Build a random sparse QP with the given number of variables and constraints.
+ * The non zero elements are drawn inside a band around the diagonal, so that the cost of the
+ * factorization grows linearly with the size of the problem. The hessian matrix is diagonally
+ * dominant, hence positive definite.
+ */
+Problem randomProblem(int numberOfVariables)
+{
+    constexpr int bandwidth = 5;
+    constexpr int nonZerosPerColumn = 2;
+    const int numberOfConstraints = numberOfVariables;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<c_float> value(-1, 1);
+    std::uniform_int_distribution<int> offset(1, bandwidth);
+
+    Problem problem;
+
+    // hessian
+    std::vector<Eigen::Triplet<c_float>> triplets;
+    std::vector<Eigen::Triplet<c_float>> tripletsNewValues;
+    VectorX diagonal = VectorX::Ones(numberOfVariables);
+    for (int col = 0; col < numberOfVariables; col++)
+    {
+        for (int k = 0; k < nonZerosPerColumn; k++)
+        {
+            const int row = col + offset(generator);
+            if (row >= numberOfVariables)
+            {
+                continue;
+            }
+            const c_float element = value(generator);
+            triplets.emplace_back(row, col, element);
+            triplets.emplace_back(col, row, element);
+            tripletsNewValues.emplace_back(row, col, 0.5 * element);
+            tripletsNewValues.emplace_back(col, row, 0.5 * element);
+            diagonal(row) += std::abs(element);
+            diagonal(col) += std::abs(element);
+        }
+    }
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        triplets.emplace_back(i, i, diagonal(i));
+        tripletsNewValues.emplace_back(i, i, diagonal(i));
+    }
+    problem.hessian.resize(numberOfVariables, numberOfVariables);
+    problem.hessian.setFromTriplets(triplets.begin(), triplets.end());
+    problem.hessianNewValues.resize(numberOfVariables, numberOfVariables);
+    problem.hessianNewValues.setFromTriplets(tripletsNewValues.begin(), tripletsNewValues.end());
+    problem.hessianNewPattern = changeHessianPattern(problem.hessian);
+
+    // linear constraints
+    triplets.clear();
+    tripletsNewValues.clear();
+    for (int col = 0; col < numberOfVariables; col++)
+    {
+        triplets.emplace_back(col, col, 1);
+        tripletsNewValues.emplace_back(col, col, 1);
+        for (int k = 0; k < nonZerosPerColumn; k++)
+        {
+            const int row = col + offset(generator);
+            if (row >= numberOfConstraints)
+            {
+                continue;
+            }
+            const c_float element = value(generator);
+            triplets.emplace_back(row, col, element);
+            tripletsNewValues.emplace_back(row, col, 0.5 * element);
+        }
+    }
+    problem.linearMatrix.resize(numberOfConstraints, numberOfVariables);
+    problem.linearMatrix.setFromTriplets(triplets.begin(), triplets.end());
+    problem.linearMatrixNewValues.resize(numberOfConstraints, numberOfVariables);
+    problem.linearMatrixNewValues.setFromTriplets(tripletsNewValues.begin(),
+                                                  tripletsNewValues.end());
+
+    problem.gradient = VectorX::NullaryExpr(numberOfVariables, [&]() { return value(generator); });
+    problem.upperBound
+        = VectorX::NullaryExpr(numberOfConstraints, [&]() { return 1 + value(generator); });
+    problem.lowerBound = -problem.upperBound;
+    problem.upperBoundNew = 1.1 * problem.upperBound;
+    problem.lowerBoundNew = 1.1 * problem.lowerBound;
+
+    return problem;
+}
+
+using ProblemFactory = Problem (*)(int);
+
+bool initializeSolver(Problem& problem, OsqpEigen::Solver& solver)
+{
+    solver.settings()->setVerbosity(false);
+    solver.data()->setNumberOfVariables(static_cast<int>(problem.hessian.cols()));
+    solver.data()->setNumberOfConstraints(static_cast<int>(problem.linearMatrix.rows()));
+    return solver.data()->setHessianMatrix(problem.hessian)
+           && solver.data()->setGradient(problem.gradient)
+           && solver.data()->setLinearConstraintsMatrix(problem.linearMatrix)
+           && solver.data()->setBounds(problem.lowerBound, problem.upperBound)
+           && solver.initSolver();
+}
+
+/**
+ * AllocationCounter counts the heap allocations performed by the measured code. The allocations
+ * are tracked only if the library is compiled with the OSQP_EIGEN_REAL_TIME_CHECKS CMake option.
+ */
+class AllocationCounter
+{
+    std::size_t m_allocations{0}; /**< Number of allocations of all the measured calls. */
+
+public:
+    /**
+     * Call the function inside a hot path scope.
+     * @param function is the function that is measured.
+     * @return the value returned by the function.
+     */
+    template <typename Function> auto measure(Function&& function) -> decltype(function())
+    {
+        OsqpEigen::RealTime::resetAllocationCount();
+        const OsqpEigen::RealTime::HotPathScope scope;
+        const auto output = function();
+        m_allocations += OsqpEigen::RealTime::getAllocationCount();
+        return output;
+    }
+
+    /**
+     * Add the average number of allocations per iteration to the benchmark counters.
+     * @param state is the state of the benchmark.
+     */
+    void report(benchmark::State& state) const
+    {
+        if (OsqpEigen::RealTime::isAllocationTrackingEnabled())
+        {
+            state.counters["allocations"]
+                = benchmark::Counter(static_cast<double>(m_allocations),
+                                     benchmark::Counter::kAvgIterations);
+        }
+    }
+};
+
+void reportProblemSize(benchmark::State& state, const Problem& problem, std::size_t itemsPerIteration)
+{
+    state.counters["variables"] = static_cast<double>(problem.hessian.cols());
+    state.counters["constraints"] = static_cast<double>(problem.linearMatrix.rows());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * itemsPerIteration));
+}
+
+std::size_t nonZeros(const Problem& problem)
+{
+    return static_cast<std::size_t>(problem.hessian.nonZeros() + problem.linearMatrix.nonZeros());
+}
+
+/**
+ * Set the hessian matrix in a Data object. If isUpperTriangular is true only the upper triangular
+ * part of the hessian is passed and it is copied without filtering.
+ */
+void setHessianMatrix(benchmark::State& state, ProblemFactory factory, bool isUpperTriangular)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    OsqpEigen::Data data(static_cast<int>(problem.hessian.cols()),
+                         static_cast<int>(problem.linearMatrix.rows()));
+    SparseMatrix hessian = problem.hessian;
+    if (isUpperTriangular)
+    {
+        hessian = problem.hessian.triangularView<Eigen::Upper>();
+    }
+    AllocationCounter counter;
+
+    for (auto _ : state)
+    {
+        if (!counter.measure([&]() { return data.setHessianMatrix(hessian, isUpperTriangular); }))
+        {
+            state.SkipWithError("Unable to set the hessian matrix.");
+            break;
+        }
+        state.PauseTiming();
+        data.clearHessianMatrix();
+        state.ResumeTiming();
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, static_cast<std::size_t>(problem.hessian.nonZeros()));
+}
+
+void SetHessianMatrix(benchmark::State& state, ProblemFactory factory)
+{
+    setHessianMatrix(state, factory, false);
+}
+
+void SetUpperTriangularHessianMatrix(benchmark::State& state, ProblemFactory factory)
+{
+    setHessianMatrix(state, factory, true);
+}
+
+void CreateOsqpSparseMatrix(benchmark::State& state, ProblemFactory factory)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    csc* osqpSparseMatrix = nullptr;
+    AllocationCounter counter;
+
+    for (auto _ : state)
+    {
+        if (!counter.measure([&]() {
+                return OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(problem.linearMatrix,
+                                                                             osqpSparseMatrix);
+            }))
+        {
+            state.SkipWithError("Unable to create the osqp sparse matrix.");
+            break;
+        }
+        state.PauseTiming();
+        OsqpEigen::spfree(osqpSparseMatrix);
+        osqpSparseMatrix = nullptr;
+        state.ResumeTiming();
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, static_cast<std::size_t>(problem.linearMatrix.nonZeros()));
+}
+
+void InitSolver(benchmark::State& state, ProblemFactory factory)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    OsqpEigen::Solver solver;
+    AllocationCounter counter;
+
+    if (!initializeSolver(problem, solver))
+    {
+        state.SkipWithError("Unable to initialize the solver.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        solver.clearSolver();
+        state.ResumeTiming();
+        if (!counter.measure([&]() { return solver.initSolver(); }))
+        {
+            state.SkipWithError("Unable to initialize the solver.");
+            break;
+        }
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, nonZeros(problem));
+}
+
+/**
+ * Update the hessian matrix alternating between the original one and the other one.
+ */
+void updateHessianMatrix(benchmark::State& state,
+                         ProblemFactory factory,
+                         SparseMatrix Problem::*other)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    OsqpEigen::Solver solver;
+    AllocationCounter counter;
+
+    if (!initializeSolver(problem, solver))
+    {
+        state.SkipWithError("Unable to initialize the solver.");
+        return;
+    }
+
+    bool useOther = true;
+    for (auto _ : state)
+    {
+        const SparseMatrix& hessian = useOther ? problem.*other : problem.hessian;
+        if (!counter.measure([&]() { return solver.updateHessianMatrix(hessian); }))
+        {
+            state.SkipWithError("Unable to update the hessian matrix.");
+            break;
+        }
+        useOther = !useOther;
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, static_cast<std::size_t>(problem.hessian.nonZeros()));
+}
+
+void UpdateHessianMatrixUnchangedPattern(benchmark::State& state, ProblemFactory factory)
+{
+    updateHessianMatrix(state, factory, &Problem::hessian);
+}
+
+void UpdateHessianMatrixChangedValues(benchmark::State& state, ProblemFactory factory)
+{
+    updateHessianMatrix(state, factory, &Problem::hessianNewValues);
+}
+
+void UpdateHessianMatrixChangedPattern(benchmark::State& state, ProblemFactory factory)
+{
+    updateHessianMatrix(state, factory, &Problem::hessianNewPattern);
+}
+
+void UpdateLinearConstraintsMatrix(benchmark::State& state, ProblemFactory factory)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    OsqpEigen::Solver solver;
+    AllocationCounter counter;
+
+    if (!initializeSolver(problem, solver))
+    {
+        state.SkipWithError("Unable to initialize the solver.");
+        return;
+    }
+
+    bool useNewValues = true;
+    for (auto _ : state)
+    {
+        const SparseMatrix& linearMatrix
+            = useNewValues ? problem.linearMatrixNewValues : problem.linearMatrix;
+        if (!counter.measure([&]() { return solver.updateLinearConstraintsMatrix(linearMatrix); }))
+        {
+            state.SkipWithError("Unable to update the linear constraints matrix.");
+            break;
+        }
+        useNewValues = !useNewValues;
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, static_cast<std::size_t>(problem.linearMatrix.nonZeros()));
+}
+
+// the elements of a row major matrix are compared with the ones of the solver through triplets
+void UpdateLinearConstraintsMatrixRowMajor(benchmark::State& state, ProblemFactory factory)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    OsqpEigen::Solver solver;
+    AllocationCounter counter;
+
+    if (!initializeSolver(problem, solver))
+    {
+        state.SkipWithError("Unable to initialize the solver.");
+        return;
+    }
+
+    const Eigen::SparseMatrix<c_float, Eigen::RowMajor> linearMatrix = problem.linearMatrix;
+    const Eigen::SparseMatrix<c_float, Eigen::RowMajor> linearMatrixNewValues
+        = problem.linearMatrixNewValues;
+
+    bool useNewValues = true;
+    for (auto _ : state)
+    {
+        const auto& rowMajorMatrix = useNewValues ? linearMatrixNewValues : linearMatrix;
+        if (!counter.measure(
+                [&]() { return solver.updateLinearConstraintsMatrix(rowMajorMatrix); }))
+        {
+            state.SkipWithError("Unable to update the linear constraints matrix.");
+            break;
+        }
+        useNewValues = !useNewValues;
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, static_cast<std::size_t>(problem.linearMatrix.nonZeros()));
+}
+
+void UpdateBounds(benchmark::State& state, ProblemFactory factory)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    OsqpEigen::Solver solver;
+    AllocationCounter counter;
+
+    if (!initializeSolver(problem, solver))
+    {
+        state.SkipWithError("Unable to initialize the solver.");
+        return;
+    }
+
+    bool useNewBounds = true;
+    for (auto _ : state)
+    {
+        const VectorX& lowerBound = useNewBounds ? problem.lowerBoundNew : problem.lowerBound;
+        const VectorX& upperBound = useNewBounds ? problem.upperBoundNew : problem.upperBound;
+        if (!counter.measure([&]() { return solver.updateBounds(lowerBound, upperBound); }))
+        {
+            state.SkipWithError("Unable to update the bounds.");
+            break;
+        }
+        useNewBounds = !useNewBounds;
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, static_cast<std::size_t>(problem.linearMatrix.rows()));
+}
+
+void SolveProblem(benchmark::State& state, ProblemFactory factory)
+{
+    Problem problem = factory(static_cast<int>(state.range(0)));
+    OsqpEigen::Solver solver;
+    AllocationCounter counter;
+
+    // every iteration solves the problem from scratch
+    solver.settings()->setWarmStart(false);
+    if (!initializeSolver(problem, solver))
+    {
+        state.SkipWithError("Unable to initialize the solver.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        if (counter.measure([&]() { return solver.solveProblem(); })
+            != OsqpEigen::ErrorExitFlag::NoError)
+        {
+            state.SkipWithError("Unable to solve the problem.");
+            break;
+        }
+    }
+
+    counter.report(state);
+    reportProblemSize(state, problem, nonZeros(problem));
+}
+
+/**
+ * Find the changed values of the linear constraints matrix as done for the row major matrices,
+ * i.e. converting the stored and the new matrices into triplets.
+ */
+void DiffSparseMatrixTriplets(benchmark::State& state)
+{
+    Problem problem = randomProblem(static_cast<int>(state.range(0)));
+    csc* osqpSparseMatrix = nullptr;
+    if (!OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(problem.linearMatrix,
+                                                               osqpSparseMatrix))
+    {
+        state.SkipWithError("Unable to create the osqp sparse matrix.");
+        return;
+    }
+
+    std::vector<Eigen::Triplet<c_float>> oldTriplets, newTriplets;
+    std::vector<c_int> changedIndices;
+    std::vector<c_float> changedValues;
+    for (auto _ : state)
+    {
+        OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(osqpSparseMatrix, oldTriplets);
+        OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(problem.linearMatrixNewValues,
+                                                                   newTriplets);
+        changedIndices.clear();
+        changedValues.clear();
+        for (std::size_t i = 0; i < newTriplets.size(); i++)
+        {
+            if ((newTriplets[i].row() != oldTriplets[i].row())
+                || (newTriplets[i].col() != oldTriplets[i].col()))
+            {
+                state.SkipWithError("The sparsity pattern is changed.");
+                break;
+            }
+            if (newTriplets[i].value() != oldTriplets[i].value())
+            {
+                changedIndices.push_back(static_cast<c_int>(i));
+                changedValues.push_back(newTriplets[i].value());
+            }
+        }
+        benchmark::DoNotOptimize(changedValues.data());
+    }
+
+    OsqpEigen::spfree(osqpSparseMatrix);
+    reportProblemSize(state, problem, static_cast<std::size_t>(problem.linearMatrix.nonZeros()));
+}
+
+/**
+ * Find the changed values of the linear constraints matrix comparing its compressed-column
+ * arrays with the stored ones, as done for the column major matrices.
+ */
+void DiffSparseMatrix(benchmark::State& state)
+{
+    Problem problem = randomProblem(static_cast<int>(state.range(0)));
+    const SparseMatrix& newMatrix = problem.linearMatrixNewValues;
+    const c_int cols = static_cast<c_int>(problem.linearMatrix.cols());
+    const std::size_t nonZeros = static_cast<std::size_t>(problem.linearMatrix.nonZeros());
+    const std::vector<c_int> outerIndex(problem.linearMatrix.outerIndexPtr(),
+                                        problem.linearMatrix.outerIndexPtr() + cols + 1);
+    const std::vector<c_int> innerIndex(problem.linearMatrix.innerIndexPtr(),
+                                        problem.linearMatrix.innerIndexPtr() + nonZeros);
+    const std::vector<c_float> values(problem.linearMatrix.valuePtr(),
+                                      problem.linearMatrix.valuePtr() + nonZeros);
+
+    std::vector<c_int> changedIndices;
+    std::vector<c_float> changedValues;
+    changedIndices.reserve(nonZeros);
+    changedValues.reserve(nonZeros);
+    for (auto _ : state)
+    {
+        if (!OsqpEigen::SparseMatrixHelper::isSparsityPatternEqual(cols,
+                                                                   outerIndex.data(),
+                                                                   innerIndex.data(),
+                                                                   newMatrix.outerIndexPtr(),
+                                                                   newMatrix.innerIndexPtr()))
+        {
+            state.SkipWithError("The sparsity pattern is changed.");
+            break;
+        }
+        OsqpEigen::SparseMatrixHelper::evaluateChangedValues(static_cast<c_int>(nonZeros),
+                                                             values.data(),
+                                                             newMatrix.valuePtr(),
+                                                             changedIndices,
+                                                             changedValues);
+        benchmark::DoNotOptimize(changedValues.data());
+    }
+
+    reportProblemSize(state, problem, nonZeros);
+}
+
+// the MPC horizons are chosen to have from 11 to 100001 variables
+void mpcHorizons(benchmark::internal::Benchmark* benchmark)
+{
+    for (int horizon : {3, 33, 333, 3333, 33333})
+    {
+        benchmark->Arg(horizon);
+    }
+    benchmark->ArgName("horizon")->Unit(benchmark::kMicrosecond);
+}
+
+void randomSizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->RangeMultiplier(10)
+        ->Range(10, 100000)
+        ->ArgName("variables")
+        ->Unit(benchmark::kMicrosecond);
+}
+
+#define OSQP_EIGEN_BENCHMARK(name)                                                                 \
+    BENCHMARK_CAPTURE(name, mpc, &mpcProblem)->Apply(mpcHorizons);                                 \
+    BENCHMARK_CAPTURE(name, random, &randomProblem)->Apply(randomSizes)
+
+OSQP_EIGEN_BENCHMARK(SetHessianMatrix);
+OSQP_EIGEN_BENCHMARK(SetUpperTriangularHessianMatrix);
+OSQP_EIGEN_BENCHMARK(CreateOsqpSparseMatrix);
+OSQP_EIGEN_BENCHMARK(InitSolver);
+OSQP_EIGEN_BENCHMARK(UpdateHessianMatrixUnchangedPattern);
+OSQP_EIGEN_BENCHMARK(UpdateHessianMatrixChangedValues);
+OSQP_EIGEN_BENCHMARK(UpdateHessianMatrixChangedPattern);
+OSQP_EIGEN_BENCHMARK(UpdateLinearConstraintsMatrix);
+OSQP_EIGEN_BENCHMARK(UpdateLinearConstraintsMatrixRowMajor);
+OSQP_EIGEN_BENCHMARK(UpdateBounds);
+OSQP_EIGEN_BENCHMARK(SolveProblem);
+
+// the random matrices with 333334 variables have about 1M non zeros
+BENCHMARK(DiffSparseMatrixTriplets)
+    ->Arg(1000)
+    ->Arg(333334)
+    ->ArgName("variables")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(DiffSparseMatrix)
+    ->Arg(1000)
+    ->Arg(333334)
+    ->ArgName("variables")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
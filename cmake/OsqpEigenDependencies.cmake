@@ -16,6 +16,7 @@ endif()
 if(NOT TARGET osqp::osqp AND NOT TARGET osqp::osqpstatic)
   find_package(osqp REQUIRED)
 endif()
+find_package(Threads REQUIRED)
 
 # Select the osqp target to link, see https://github.com/robotology/osqp-eigen/issues/196
 # Advanced users can directly (for example package manager mantainers) can set the 
@@ -53,5 +54,8 @@ endif()
 find_package(Catch2 3.0.1 QUIET)
 checkandset_optional_dependency(Catch2)
 
+find_package(benchmark QUIET)
+checkandset_optional_dependency(benchmark)
+
 find_package(VALGRIND QUIET)
 checkandset_optional_dependency(VALGRIND)
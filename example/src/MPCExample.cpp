@@ -13,7 +13,7 @@
 
 #include <iostream>
 
-void setDynamicsMatrices(Eigen::Matrix<double, 12, 12>& a, Eigen::Matrix<double, 12, 4>& b)
+void setDynamicsMatrices(Eigen::Matrix<c_float, 12, 12>& a, Eigen::Matrix<c_float, 12, 4>& b)
 {
     a << 1., 0., 0., 0., 0., 0., 0.1, 0., 0., 0., 0., 0., 0., 1., 0., 0., 0., 0., 0., 0.1, 0., 0.,
         0., 0., 0., 0., 1., 0., 0., 0., 0., 0., 0.1, 0., 0., 0., 0.0488, 0., 0., 1., 0., 0., 0.0016,
@@ -29,12 +29,12 @@ void setDynamicsMatrices(Eigen::Matrix<double, 12, 12>& a, Eigen::Matrix<double,
         -0.0236, 0., 0.0236, 0.0236, 0., -0.0236, 0., 0.2107, 0.2107, 0.2107, 0.2107;
 }
 
-void setInequalityConstraints(Eigen::Matrix<double, 12, 1>& xMax,
-                              Eigen::Matrix<double, 12, 1>& xMin,
-                              Eigen::Matrix<double, 4, 1>& uMax,
-                              Eigen::Matrix<double, 4, 1>& uMin)
+void setInequalityConstraints(Eigen::Matrix<c_float, 12, 1>& xMax,
+                              Eigen::Matrix<c_float, 12, 1>& xMin,
+                              Eigen::Matrix<c_float, 4, 1>& uMax,
+                              Eigen::Matrix<c_float, 4, 1>& uMin)
 {
-    double u0 = 10.5916;
+    c_float u0 = 10.5916;
 
     // input inequality constraints
     uMin << 9.6 - u0, 9.6 - u0, 9.6 - u0, 9.6 - u0;
@@ -51,154 +51,17 @@ void setInequalityConstraints(Eigen::Matrix<double, 12, 1>& xMax,
         OsqpEigen::INFTY, OsqpEigen::INFTY;
 }
 
-void setWeightMatrices(Eigen::DiagonalMatrix<double, 12>& Q, Eigen::DiagonalMatrix<double, 4>& R)
+void setWeightMatrices(Eigen::DiagonalMatrix<c_float, 12>& Q, Eigen::DiagonalMatrix<c_float, 4>& R)
 {
     Q.diagonal() << 0, 0, 10., 10., 10., 10., 0, 0, 0, 5., 5., 5.;
     R.diagonal() << 0.1, 0.1, 0.1, 0.1;
 }
 
-void castMPCToQPHessian(const Eigen::DiagonalMatrix<double, 12>& Q,
-                        const Eigen::DiagonalMatrix<double, 4>& R,
-                        int mpcWindow,
-                        Eigen::SparseMatrix<double>& hessianMatrix)
-{
-
-    hessianMatrix.resize(12 * (mpcWindow + 1) + 4 * mpcWindow,
-                         12 * (mpcWindow + 1) + 4 * mpcWindow);
-
-    // populate hessian matrix
-    for (int i = 0; i < 12 * (mpcWindow + 1) + 4 * mpcWindow; i++)
-    {
-        if (i < 12 * (mpcWindow + 1))
-        {
-            int posQ = i % 12;
-            float value = Q.diagonal()[posQ];
-            if (value != 0)
-                hessianMatrix.insert(i, i) = value;
-        } else
-        {
-            int posR = i % 4;
-            float value = R.diagonal()[posR];
-            if (value != 0)
-                hessianMatrix.insert(i, i) = value;
-        }
-    }
-}
-
-void castMPCToQPGradient(const Eigen::DiagonalMatrix<double, 12>& Q,
-                         const Eigen::Matrix<double, 12, 1>& xRef,
-                         int mpcWindow,
-                         Eigen::VectorXd& gradient)
-{
-
-    Eigen::Matrix<double, 12, 1> Qx_ref;
-    Qx_ref = Q * (-xRef);
-
-    // populate the gradient vector
-    gradient = Eigen::VectorXd::Zero(12 * (mpcWindow + 1) + 4 * mpcWindow, 1);
-    for (int i = 0; i < 12 * (mpcWindow + 1); i++)
-    {
-        int posQ = i % 12;
-        float value = Qx_ref(posQ, 0);
-        gradient(i, 0) = value;
-    }
-}
-
-void castMPCToQPConstraintMatrix(const Eigen::Matrix<double, 12, 12>& dynamicMatrix,
-                                 const Eigen::Matrix<double, 12, 4>& controlMatrix,
-                                 int mpcWindow,
-                                 Eigen::SparseMatrix<double>& constraintMatrix)
-{
-    constraintMatrix.resize(12 * (mpcWindow + 1) + 12 * (mpcWindow + 1) + 4 * mpcWindow,
-                            12 * (mpcWindow + 1) + 4 * mpcWindow);
-
-    // populate linear constraint matrix
-    for (int i = 0; i < 12 * (mpcWindow + 1); i++)
-    {
-        constraintMatrix.insert(i, i) = -1;
-    }
-
-    for (int i = 0; i < mpcWindow; i++)
-        for (int j = 0; j < 12; j++)
-            for (int k = 0; k < 12; k++)
-            {
-                float value = dynamicMatrix(j, k);
-                if (value != 0)
-                {
-                    constraintMatrix.insert(12 * (i + 1) + j, 12 * i + k) = value;
-                }
-            }
-
-    for (int i = 0; i < mpcWindow; i++)
-        for (int j = 0; j < 12; j++)
-            for (int k = 0; k < 4; k++)
-            {
-                float value = controlMatrix(j, k);
-                if (value != 0)
-                {
-                    constraintMatrix.insert(12 * (i + 1) + j, 4 * i + k + 12 * (mpcWindow + 1))
-                        = value;
-                }
-            }
-
-    for (int i = 0; i < 12 * (mpcWindow + 1) + 4 * mpcWindow; i++)
-    {
-        constraintMatrix.insert(i + (mpcWindow + 1) * 12, i) = 1;
-    }
-}
-
-void castMPCToQPConstraintVectors(const Eigen::Matrix<double, 12, 1>& xMax,
-                                  const Eigen::Matrix<double, 12, 1>& xMin,
-                                  const Eigen::Matrix<double, 4, 1>& uMax,
-                                  const Eigen::Matrix<double, 4, 1>& uMin,
-                                  const Eigen::Matrix<double, 12, 1>& x0,
-                                  int mpcWindow,
-                                  Eigen::VectorXd& lowerBound,
-                                  Eigen::VectorXd& upperBound)
-{
-    // evaluate the lower and the upper inequality vectors
-    Eigen::VectorXd lowerInequality
-        = Eigen::MatrixXd::Zero(12 * (mpcWindow + 1) + 4 * mpcWindow, 1);
-    Eigen::VectorXd upperInequality
-        = Eigen::MatrixXd::Zero(12 * (mpcWindow + 1) + 4 * mpcWindow, 1);
-    for (int i = 0; i < mpcWindow + 1; i++)
-    {
-        lowerInequality.block(12 * i, 0, 12, 1) = xMin;
-        upperInequality.block(12 * i, 0, 12, 1) = xMax;
-    }
-    for (int i = 0; i < mpcWindow; i++)
-    {
-        lowerInequality.block(4 * i + 12 * (mpcWindow + 1), 0, 4, 1) = uMin;
-        upperInequality.block(4 * i + 12 * (mpcWindow + 1), 0, 4, 1) = uMax;
-    }
-
-    // evaluate the lower and the upper equality vectors
-    Eigen::VectorXd lowerEquality = Eigen::MatrixXd::Zero(12 * (mpcWindow + 1), 1);
-    Eigen::VectorXd upperEquality;
-    lowerEquality.block(0, 0, 12, 1) = -x0;
-    upperEquality = lowerEquality;
-    lowerEquality = lowerEquality;
-
-    // merge inequality and equality vectors
-    lowerBound = Eigen::MatrixXd::Zero(2 * 12 * (mpcWindow + 1) + 4 * mpcWindow, 1);
-    lowerBound << lowerEquality, lowerInequality;
-
-    upperBound = Eigen::MatrixXd::Zero(2 * 12 * (mpcWindow + 1) + 4 * mpcWindow, 1);
-    upperBound << upperEquality, upperInequality;
-}
-
-void updateConstraintVectors(const Eigen::Matrix<double, 12, 1>& x0,
-                             Eigen::VectorXd& lowerBound,
-                             Eigen::VectorXd& upperBound)
-{
-    lowerBound.block(0, 0, 12, 1) = -x0;
-    upperBound.block(0, 0, 12, 1) = -x0;
-}
-
-double getErrorNorm(const Eigen::Matrix<double, 12, 1>& x, const Eigen::Matrix<double, 12, 1>& xRef)
+c_float getErrorNorm(const Eigen::Matrix<c_float, 12, 1>& x,
+                     const Eigen::Matrix<c_float, 12, 1>& xRef)
 {
     // evaluate the error
-    Eigen::Matrix<double, 12, 1> error = x - xRef;
+    Eigen::Matrix<c_float, 12, 1> error = x - xRef;
 
     // return the norm
     return error.norm();
@@ -210,29 +73,22 @@ int main()
     int mpcWindow = 20;
 
     // allocate the dynamics matrices
-    Eigen::Matrix<double, 12, 12> a;
-    Eigen::Matrix<double, 12, 4> b;
+    Eigen::Matrix<c_float, 12, 12> a;
+    Eigen::Matrix<c_float, 12, 4> b;
 
     // allocate the constraints vector
-    Eigen::Matrix<double, 12, 1> xMax;
-    Eigen::Matrix<double, 12, 1> xMin;
-    Eigen::Matrix<double, 4, 1> uMax;
-    Eigen::Matrix<double, 4, 1> uMin;
+    Eigen::Matrix<c_float, 12, 1> xMax;
+    Eigen::Matrix<c_float, 12, 1> xMin;
+    Eigen::Matrix<c_float, 4, 1> uMax;
+    Eigen::Matrix<c_float, 4, 1> uMin;
 
     // allocate the weight matrices
-    Eigen::DiagonalMatrix<double, 12> Q;
-    Eigen::DiagonalMatrix<double, 4> R;
+    Eigen::DiagonalMatrix<c_float, 12> Q;
+    Eigen::DiagonalMatrix<c_float, 4> R;
 
     // allocate the initial and the reference state space
-    Eigen::Matrix<double, 12, 1> x0;
-    Eigen::Matrix<double, 12, 1> xRef;
-
-    // allocate QP problem matrices and vectors
-    Eigen::SparseMatrix<double> hessian;
-    Eigen::VectorXd gradient;
-    Eigen::SparseMatrix<double> linearMatrix;
-    Eigen::VectorXd lowerBound;
-    Eigen::VectorXd upperBound;
+    Eigen::Matrix<c_float, 12, 1> x0;
+    Eigen::Matrix<c_float, 12, 1> xRef;
 
     // set the initial and the desired states
     x0 << 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0;
@@ -243,11 +99,21 @@ int main()
     setInequalityConstraints(xMax, xMin, uMax, uMin);
     setWeightMatrices(Q, R);
 
-    // cast the MPC problem as QP problem
-    castMPCToQPHessian(Q, R, mpcWindow, hessian);
-    castMPCToQPGradient(Q, xRef, mpcWindow, gradient);
-    castMPCToQPConstraintMatrix(a, b, mpcWindow, linearMatrix);
-    castMPCToQPConstraintVectors(xMax, xMin, uMax, uMin, x0, mpcWindow, lowerBound, upperBound);
+    // cast the MPC problem as QP problem. The compressed matrices are allocated once by the
+    // builder and the blocks of each stage can be updated in place
+    OsqpEigen::MPCProblemBuilder mpcProblem(12, 4, mpcWindow);
+    if (!mpcProblem.setDynamics(a, b))
+        return 1;
+    if (!mpcProblem.setWeights(Q.toDenseMatrix(), R.toDenseMatrix()))
+        return 1;
+    if (!mpcProblem.setStateBounds(xMin, xMax))
+        return 1;
+    if (!mpcProblem.setInputBounds(uMin, uMax))
+        return 1;
+    if (!mpcProblem.setInitialState(x0))
+        return 1;
+    if (!mpcProblem.setStateReference(xRef))
+        return 1;
 
     // instantiate the solver
     OsqpEigen::Solver solver;
@@ -257,17 +123,7 @@ int main()
     solver.settings()->setWarmStart(true);
 
     // set the initial data of the QP solver
-    solver.data()->setNumberOfVariables(12 * (mpcWindow + 1) + 4 * mpcWindow);
-    solver.data()->setNumberOfConstraints(2 * 12 * (mpcWindow + 1) + 4 * mpcWindow);
-    if (!solver.data()->setHessianMatrix(hessian))
-        return 1;
-    if (!solver.data()->setGradient(gradient))
-        return 1;
-    if (!solver.data()->setLinearConstraintsMatrix(linearMatrix))
-        return 1;
-    if (!solver.data()->setLowerBound(lowerBound))
-        return 1;
-    if (!solver.data()->setUpperBound(upperBound))
+    if (!mpcProblem.setSolverData(*solver.data()))
         return 1;
 
     // instantiate the solver
@@ -275,8 +131,8 @@ int main()
         return 1;
 
     // controller input and QPSolution vector
-    Eigen::Vector4d ctr;
-    Eigen::VectorXd QPSolution;
+    Eigen::Matrix<c_float, 4, 1> ctr;
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> QPSolution;
 
     // number of iteration steps
     int numberOfSteps = 50;
@@ -292,15 +148,13 @@ int main()
         QPSolution = solver.getSolution();
         ctr = QPSolution.block(12 * (mpcWindow + 1), 0, 4, 1);
 
-        // save data into file
-        auto x0Data = x0.data();
-
         // propagate the model
         x0 = a * x0 + b * ctr;
 
         // update the constraint bound
-        updateConstraintVectors(x0, lowerBound, upperBound);
-        if (!solver.updateBounds(lowerBound, upperBound))
+        if (!mpcProblem.setInitialState(x0))
+            return 1;
+        if (!solver.updateBounds(mpcProblem.getLowerBound(), mpcProblem.getUpperBound()))
             return 1;
     }
     return 0;
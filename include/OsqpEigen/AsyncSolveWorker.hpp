@@ -0,0 +1,187 @@
+/**
+ * @file AsyncSolveWorker.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_ASYNC_SOLVE_WORKER_HPP
+#define OSQPEIGEN_ASYNC_SOLVE_WORKER_HPP
+
+// Std
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+// Eigen
+#include <Eigen/Dense>
+
+// OsqpEigen
+#include <OsqpEigen/Compat.hpp>
+#include <OsqpEigen/Constants.hpp>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * AsyncSolveWorker class owns the thread running the asynchronous solves of a Solver. The solves
+ * are run in the order they are submitted. The gradient and the bounds updated while a solve is
+ * submitted and not completed are stored by the worker, then they are sent together to the OSQP
+ * workspace before the next solve.
+ */
+class AsyncSolveWorker
+{
+public:
+    /**
+     * Result of the request of queueing a bound.
+     */
+    enum class QueueResult
+    {
+        NotQueued, /**< No solve is pending, the bound has to be sent to the workspace. */
+        Queued, /**< The bound is queued. */
+        Rejected /**< The lower bound is greater than the upper bound, nothing is queued. */
+    };
+
+private:
+    /**
+     * Solve waiting to be run by the worker thread.
+     */
+    struct Task
+    {
+        std::function<OsqpEigen::ErrorExitFlag()> solve; /**< Function solving the problem. */
+        std::promise<OsqpEigen::ErrorExitFlag> promise; /**< Promise set when it is completed. */
+    };
+
+    std::thread m_thread; /**< Worker thread. */
+    std::mutex m_mutex; /**< Mutex protecting the tasks and the queued updates. */
+    std::condition_variable m_taskCondition; /**< Used to wake up the worker. */
+    std::deque<Task> m_tasks; /**< Solves waiting to be run. */
+    std::size_t m_numberOfPendingSolves; /**< Solves submitted and not completed. */
+    bool m_stop; /**< Boolean true if the worker has to be stopped. */
+
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_gradient; /**< Queued gradient. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_lowerBound; /**< Queued lower bound. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_upperBound; /**< Queued upper bound. */
+    bool m_isGradientQueued; /**< Boolean true if the gradient has to be sent to the workspace. */
+    bool m_isLowerBoundQueued; /**< Boolean true if the lower bound has to be sent to the
+                                  workspace. */
+    bool m_isUpperBoundQueued; /**< Boolean true if the upper bound has to be sent to the
+                                  workspace. */
+
+    /**
+     * Loop executed by the worker thread.
+     */
+    void workerLoop();
+
+    /**
+     * Store a vector if a solve is pending, otherwise drop the queued one.
+     * @param vector is the new vector;
+     * @param queuedVector is the vector stored by the worker;
+     * @param isQueued is the flag of the queued vector.
+     * @note m_mutex has to be locked by the caller.
+     * @return true if the vector is queued, false if it has to be sent to the workspace.
+     */
+    bool queue(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& vector,
+               Eigen::Matrix<c_float, Eigen::Dynamic, 1>& queuedVector,
+               bool& isQueued);
+
+public:
+    /**
+     * Constructor. The worker thread is started.
+     * @param numberOfVariables is the size of the gradient;
+     * @param numberOfConstraints is the size of the bounds.
+     */
+    AsyncSolveWorker(c_int numberOfVariables, c_int numberOfConstraints);
+
+    /**
+     * Deconstructor. The solves already submitted are completed, then the thread is joined.
+     */
+    ~AsyncSolveWorker();
+
+    AsyncSolveWorker(const AsyncSolveWorker&) = delete;
+    AsyncSolveWorker& operator=(const AsyncSolveWorker&) = delete;
+
+    /**
+     * Check if the calling thread is the worker thread, e.g. if it is called by the completion
+     * callback of a solve. The worker thread cannot destroy the worker, since it cannot join
+     * itself.
+     * @return true if the calling thread is the worker thread.
+     */
+    bool isWorkerThread() const;
+
+    /**
+     * Drop the queued vectors.
+     */
+    void clearQueuedUpdates();
+
+    /**
+     * Pin the worker thread to a CPU.
+     * @param cpu is the index of the CPU.
+     * @note it is supported only on Linux.
+     * @return true/false in case of success/failure.
+     */
+    bool setCpuAffinity(int cpu);
+
+    /**
+     * Submit a solve.
+     * @param solve is the function solving the problem. It is called by the worker thread.
+     * @return the future that gets the error exit flag returned by solve, or the exception
+     * thrown by solve.
+     */
+    std::future<OsqpEigen::ErrorExitFlag> submit(std::function<OsqpEigen::ErrorExitFlag()> solve);
+
+    /**
+     * Queue the gradient if a solve is pending.
+     * @param gradient is the gradient vector.
+     * @return true if the gradient is queued, false if it has to be sent to the workspace.
+     */
+    bool queueGradient(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& gradient);
+
+    /**
+     * Queue the lower bound if a solve is pending. It is checked against the queued upper bound.
+     * @param lowerBound is the lower bound vector.
+     * @note if the upper bound is not queued, the lower bound is checked by OSQP when it is sent
+     * to the workspace, since the workspace can be initialized again by the worker thread.
+     * @return the result of the request.
+     */
+    QueueResult
+    queueLowerBound(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound);
+
+    /**
+     * Queue the upper bound if a solve is pending. It is checked against the queued lower bound.
+     * @param upperBound is the upper bound vector.
+     * @note if the lower bound is not queued, the upper bound is checked by OSQP when it is sent
+     * to the workspace, since the workspace can be initialized again by the worker thread.
+     * @return the result of the request.
+     */
+    QueueResult
+    queueUpperBound(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound);
+
+    /**
+     * Queue both the lower and the upper bounds if a solve is pending and if the lower bound is
+     * not greater than the upper bound.
+     * @param lowerBound is the lower bound vector;
+     * @param upperBound is the upper bound vector.
+     * @return the result of the request.
+     */
+    QueueResult
+    queueBounds(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound,
+                const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound);
+
+    /**
+     * Send the queued vectors to the workspace. The vectors cannot be queued in the meantime.
+     * @param update is the function updating the workspace. The pointers of the vectors that are
+     * not queued are null pointers.
+     * @return true if no vector is queued or if update succeeds.
+     */
+    bool applyQueuedUpdates(
+        const std::function<bool(const c_float*, const c_float*, const c_float*)>& update);
+};
+} // namespace OsqpEigen
+
+#endif
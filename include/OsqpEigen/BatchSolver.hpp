@@ -0,0 +1,209 @@
+/**
+ * @file BatchSolver.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_BATCH_SOLVER_HPP
+#define OSQPEIGEN_BATCH_SOLVER_HPP
+
+// Std
+#include <memory>
+#include <vector>
+
+// Eigen
+#include <Eigen/Dense>
+
+// OsqpEigen
+#include <OsqpEigen/Compat.hpp>
+#include <OsqpEigen/Constants.hpp>
+#include <OsqpEigen/Data.hpp>
+#include <OsqpEigen/Settings.hpp>
+#include <OsqpEigen/Solver.hpp>
+#include <OsqpEigen/ThreadPool.hpp>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * BatchSolver class solves many independent QP problems sharing the same sparsity pattern and
+ * the same settings. Each problem owns an OSQP workspace and the problems are solved in parallel
+ * by a pool of threads.
+ * The sparsity pattern, and the initial values, of all the problems are the ones set in the
+ * Data object returned by data(). The gradients, the bounds and the values of the matrices of
+ * each problem can be then changed by passing matrices having one column per problem.
+ */
+class BatchSolver
+{
+    bool m_isSolverInitialized; /**< Boolean true if solver is initialized. */
+    std::unique_ptr<OsqpEigen::Settings> m_settings; /**< Settings shared by all the problems. */
+    std::unique_ptr<OsqpEigen::Data> m_data; /**< Data shared by all the problems. */
+    std::vector<std::unique_ptr<OsqpEigen::Solver>> m_solvers; /**< One solver per problem. */
+    std::unique_ptr<OsqpEigen::ThreadPool> m_threadPool; /**< Pool solving the problems. */
+
+    Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic> m_gradients; /**< Gradients (n x N). */
+    Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic> m_lowerBounds; /**< Lower bounds. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic> m_upperBounds; /**< Upper bounds. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic> m_hessianValues; /**< Values of P. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic> m_linearConstraintsValues; /**< Values
+                                                                                         of A. */
+
+    /**
+     * PendingUpdates struct contains the data of a problem that have not been sent to its solver
+     * yet.
+     */
+    struct PendingUpdates
+    {
+        bool isGradientToUpdate{false}; /**< Boolean true if the gradient has to be sent. */
+        bool areBoundsToUpdate{false}; /**< Boolean true if the bounds have to be sent. */
+        bool isHessianToUpdate{false}; /**< Boolean true if the hessian values have to be sent. */
+        bool isLinearConstraintsToUpdate{false}; /**< Boolean true if the linear constraints
+                                                    values have to be sent. */
+    };
+    std::vector<PendingUpdates> m_pendingUpdates; /**< Pending updates of each problem. */
+
+    Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic> m_solutions; /**< Primal solutions. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic> m_dualSolutions; /**< Dual solutions. */
+    std::vector<OsqpEigen::ErrorExitFlag> m_errorExitFlags; /**< Error flag of each problem. */
+    std::vector<OsqpEigen::Status> m_status; /**< Status of each problem. */
+
+    /**
+     * Check the size of a matrix containing one column per problem.
+     * @param matrix is the matrix;
+     * @param rows is the expected number of rows;
+     * @param functionName is the name of the calling function used in the error message.
+     * @return true if the matrix size is correct.
+     */
+    bool checkSize(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>&
+                       matrix,
+                   Eigen::Index rows,
+                   const char* functionName) const;
+
+public:
+    /**
+     * Constructor.
+     */
+    BatchSolver();
+
+    /**
+     * Initialize the solvers of all the problems with the data and the settings.
+     * @param numberOfProblems is the number of problems solved together;
+     * @param numberOfThreads is the number of threads solving the problems. If it is equal to
+     * zero the number of concurrent threads supported by the hardware is used.
+     * @return true/false in case of success/failure.
+     */
+    bool initSolver(int numberOfProblems, int numberOfThreads = 0);
+
+    /**
+     * Check if the solver is initialized.
+     * @return true if the solver is initialized.
+     */
+    bool isInitialized() const;
+
+    /**
+     * Deallocate memory.
+     */
+    void clearSolver();
+
+    /**
+     * Get the number of problems.
+     * @return the number of problems solved together.
+     */
+    int getNumberOfProblems() const;
+
+    /**
+     * Update the linear part of the cost function of all the problems.
+     * @param gradients is a n x N matrix containing the gradient of each problem.
+     * @note the gradients are copied and sent to the solvers in solveProblems().
+     * @return true/false in case of success/failure.
+     */
+    bool updateGradients(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& gradients);
+
+    /**
+     * Update both upper and lower bounds of all the problems.
+     * @param lowerBounds is a m x N matrix containing the lower bound of each problem;
+     * @param upperBounds is a m x N matrix containing the upper bound of each problem.
+     * @note the bounds are copied and sent to the solvers in solveProblems().
+     * @return true/false in case of success/failure.
+     */
+    bool updateBounds(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& lowerBounds,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>&
+            upperBounds);
+
+    /**
+     * Update the values of the hessian matrices of all the problems.
+     * @param hessianValues is a matrix containing one column per problem. Each column contains
+     * the non zero values of the upper triangular part of the hessian in compressed-column order
+     * (see Solver::updateHessianValues()).
+     * @note the values are copied and sent to the solvers in solveProblems().
+     * @return true/false in case of success/failure.
+     */
+    bool updateHessianValues(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>&
+            hessianValues);
+
+    /**
+     * Update the values of the linear constraints matrices of all the problems.
+     * @param linearConstraintsValues is a matrix containing one column per problem. Each column
+     * contains the non zero values of the linear constraints matrix in compressed-column order
+     * (see Solver::updateLinearConstraintsValues()).
+     * @note the values are copied and sent to the solvers in solveProblems().
+     * @return true/false in case of success/failure.
+     */
+    bool updateLinearConstraintsValues(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>&
+            linearConstraintsValues);
+
+    /**
+     * Solve all the QP problems.
+     * @note if the data of a problem cannot be sent to its solver, the problem is not solved and
+     * its error exit flag is DataValidationError. The data that have not been sent are sent again
+     * by the next call, unless they are replaced by an update.
+     * @return NoError if all the problems are solved without errors, otherwise the error exit
+     * flag of the first problem that failed.
+     */
+    OsqpEigen::ErrorExitFlag solveProblems();
+
+    /**
+     * Get the error exit flag of each problem.
+     * @return a vector containing the error exit flag of each problem.
+     */
+    const std::vector<OsqpEigen::ErrorExitFlag>& getErrorExitFlags() const;
+
+    /**
+     * Get the status of each problem.
+     * @return a vector containing the status of each problem.
+     */
+    const std::vector<OsqpEigen::Status>& getStatus() const;
+
+    /**
+     * Get the primal solutions.
+     * @return a n x N matrix containing the solution of each problem.
+     */
+    const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>& getSolutions() const;
+
+    /**
+     * Get the dual solutions.
+     * @return a m x N matrix containing the dual solution of each problem.
+     */
+    const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>& getDualSolutions() const;
+
+    /**
+     * Get the settings shared by all the problems.
+     * @return the pointer to Settings object.
+     */
+    const std::unique_ptr<OsqpEigen::Settings>& settings() const;
+
+    /**
+     * Get the data shared by all the problems.
+     * @return the pointer to Data object.
+     */
+    const std::unique_ptr<OsqpEigen::Data>& data() const;
+};
+} // namespace OsqpEigen
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * @file BoundedQueue.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_BOUNDED_QUEUE_HPP
+#define OSQPEIGEN_BOUNDED_QUEUE_HPP
+
+// Std
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * BoundedQueue is a fixed size lock-free first in first out queue. Several threads can push and
+ * pop at the same time. Pushing and popping neither lock nor allocate memory.
+ * @tparam T is the type of the elements. It has to be default constructible and copy assignable.
+ */
+template <typename T> class BoundedQueue
+{
+    /**
+     * Cell of the queue. The sequence number tells if the cell can be written or read.
+     */
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> m_cells; /**< Storage of the elements. */
+    std::size_t m_mask; /**< Capacity minus one, the capacity is a power of two. */
+    std::atomic<std::size_t> m_writePosition; /**< Position of the next element to write. */
+    std::atomic<std::size_t> m_readPosition; /**< Position of the next element to read. */
+
+public:
+    /**
+     * Constructor. It allocates the memory of the queue.
+     * @param capacity is the number of elements that can be stored. It is rounded up to the next
+     * power of two.
+     */
+    explicit BoundedQueue(std::size_t capacity);
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * Get the number of elements that can be stored.
+     * @return the capacity of the queue.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * Add an element to the queue.
+     * @param value is the element.
+     * @return true if the element has been stored, false if the queue is full.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * Remove the oldest element from the queue.
+     * @param value is the element removed.
+     * @return true if an element has been removed, false if the queue is empty.
+     */
+    bool pop(T& value) noexcept;
+};
+} // namespace OsqpEigen
+
+#include <OsqpEigen/BoundedQueue.tpp>
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file BoundedQueue.tpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+template <typename T>
+OsqpEigen::BoundedQueue<T>::BoundedQueue(std::size_t capacity)
+    : m_writePosition(0)
+    , m_readPosition(0)
+{
+    std::size_t roundedCapacity = 1;
+    while (roundedCapacity < capacity)
+    {
+        roundedCapacity *= 2;
+    }
+
+    m_mask = roundedCapacity - 1;
+    m_cells.reset(new Cell[roundedCapacity]);
+    for (std::size_t i = 0; i < roundedCapacity; i++)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T> std::size_t OsqpEigen::BoundedQueue<T>::capacity() const
+{
+    return m_mask + 1;
+}
+
+template <typename T> bool OsqpEigen::BoundedQueue<T>::push(const T& value) noexcept
+{
+    // a cell can be written when its sequence number is equal to the write position. The
+    // position is reserved with a compare and swap, hence several threads can push at the same
+    // time
+    std::size_t position = m_writePosition.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true)
+    {
+        cell = &m_cells[position & m_mask];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference
+            = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (difference == 0)
+        {
+            if (m_writePosition.compare_exchange_weak(position,
+                                                      position + 1,
+                                                      std::memory_order_relaxed))
+            {
+                break;
+            }
+        } else if (difference < 0)
+        {
+            // the cell still contains an element that has not been read
+            return false;
+        } else
+        {
+            position = m_writePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->value = value;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T> bool OsqpEigen::BoundedQueue<T>::pop(T& value) noexcept
+{
+    // a cell can be read when its sequence number is equal to the read position plus one
+    std::size_t position = m_readPosition.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true)
+    {
+        cell = &m_cells[position & m_mask];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference
+            = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+        if (difference == 0)
+        {
+            if (m_readPosition.compare_exchange_weak(position,
+                                                     position + 1,
+                                                     std::memory_order_relaxed))
+            {
+                break;
+            }
+        } else if (difference < 0)
+        {
+            return false;
+        } else
+        {
+            position = m_readPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    value = cell->value;
+    cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+    return true;
+}
@@ -109,6 +109,30 @@ inline void spfree(OSQPCscMatrix* M)
     }
 }
 
+inline OSQPCscMatrix* spwrap(OSQPInt m,
+                             OSQPInt n,
+                             OSQPInt nnz,
+                             OSQPFloat* x,
+                             OSQPInt* i,
+                             OSQPInt* p)
+{
+    // only the struct is allocated, the arrays are owned by the caller
+    OSQPCscMatrix* M = static_cast<OSQPCscMatrix*>(calloc(1, sizeof(OSQPCscMatrix)));
+    if (!M)
+    {
+        return static_cast<OSQPCscMatrix*>(OSQP_NULL);
+    }
+
+    OSQPEigen_OSQPCscMatrix_set_data(M, m, n, nnz, x, i, p);
+
+    return M;
+}
+
+inline void spunwrap(OSQPCscMatrix* M)
+{
+    free(M);
+}
+
 } // namespace OsqpEigen
 
 #else
@@ -126,6 +150,31 @@ inline void spfree(csc* M)
     return csc_spfree(M);
 }
 
+inline csc* spwrap(c_int m, c_int n, c_int nnz, c_float* x, c_int* i, c_int* p)
+{
+    // only the struct is allocated, the arrays are owned by the caller
+    csc* M = static_cast<csc*>(c_malloc(sizeof(csc)));
+    if (!M)
+    {
+        return static_cast<csc*>(OSQP_NULL);
+    }
+
+    M->m = m;
+    M->n = n;
+    M->nzmax = nnz;
+    M->nz = -1;
+    M->x = x;
+    M->i = i;
+    M->p = p;
+
+    return M;
+}
+
+inline void spunwrap(csc* M)
+{
+    c_free(M);
+}
+
 } // namespace OsqpEigen
 
 
@@ -8,6 +8,10 @@
 #ifndef OSQPEIGEN_DATA_HPP
 #define OSQPEIGEN_DATA_HPP
 
+// Std
+#include <array>
+#include <type_traits>
+
 // Eigen
 #include <Eigen/Dense>
 
@@ -35,6 +39,91 @@ class Data
     bool m_isLinearConstraintsMatrixSet; /**< Boolean true if the linear constrain matrix is set. */
     bool m_isLowerBoundSet; /**< Boolean true if the lower bound vector is set. */
     bool m_isUpperBoundSet; /**< Boolean true if the upper bound vector is set. */
+    bool m_isHessianMatrixBorrowed; /**< Boolean true if the hessian matrix storage is owned by
+                                       the user. */
+    bool m_isLinearConstraintsMatrixBorrowed; /**< Boolean true if the linear constraints matrix
+                                                 storage is owned by the user. */
+
+    /**
+     * BorrowedMatrix struct stores the address of a borrowed matrix and of its arrays. It is used
+     * to detect if the matrix has been reallocated while it is borrowed. The matrix is accessed
+     * through the stored address, hence it has to be alive.
+     */
+    struct BorrowedMatrix
+    {
+        const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>* matrix{nullptr};
+        const c_int* outerIndex{nullptr};
+        const c_int* innerIndex{nullptr};
+        const c_float* values{nullptr};
+        Eigen::Index nonZeros{0};
+
+        /**
+         * Store the address of the matrix and of its arrays.
+         * @param borrowedMatrix is the borrowed matrix.
+         */
+        void set(const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& borrowedMatrix);
+
+        /**
+         * Check if the matrix still uses the arrays stored in set().
+         * @return true if the arrays are unchanged or no matrix is borrowed.
+         */
+        bool isValid() const;
+    };
+
+    /**
+     * VectorsBuffer struct contains a copy of the gradient and of the bounds.
+     */
+    struct VectorsBuffer
+    {
+        Eigen::Matrix<c_float, Eigen::Dynamic, 1> gradient; /**< Gradient vector. */
+        Eigen::Matrix<c_float, Eigen::Dynamic, 1> lowerBound; /**< Lower bound vector. */
+        Eigen::Matrix<c_float, Eigen::Dynamic, 1> upperBound; /**< Upper bound vector. */
+        bool isGradientSet{false}; /**< Boolean true if the gradient is set. */
+        bool isLowerBoundSet{false}; /**< Boolean true if the lower bound is set. */
+        bool isUpperBoundSet{false}; /**< Boolean true if the upper bound is set. */
+    };
+
+    bool m_areVectorsCopied; /**< Boolean true if the gradient and the bounds are copied. */
+    bool m_areVectorsDoubleBuffered; /**< Boolean true if two copies of the vectors are kept. */
+    std::array<VectorsBuffer, 2> m_vectorsBuffers; /**< Copies of the gradient and the bounds. */
+    std::size_t m_frontBufferIndex; /**< Index of the buffer pointed by the OSQPData struct. */
+
+    /**
+     * Get the buffer filled by the setters of the gradient and of the bounds.
+     * @return the back buffer if the vectors are double buffered, the front one otherwise.
+     */
+    VectorsBuffer& writableVectorsBuffer();
+
+    /**
+     * Mark the gradient of the writable buffer as set. If the vectors are not double buffered the
+     * OSQPData struct points to it.
+     */
+    void commitCopiedGradient();
+
+    /**
+     * Mark the lower bound of the writable buffer as set. If the vectors are not double buffered
+     * the OSQPData struct points to it.
+     */
+    void commitCopiedLowerBound();
+
+    /**
+     * Mark the upper bound of the writable buffer as set. If the vectors are not double buffered
+     * the OSQPData struct points to it.
+     */
+    void commitCopiedUpperBound();
+
+    BorrowedMatrix m_borrowedHessianMatrix; /**< Borrowed hessian matrix. */
+    BorrowedMatrix m_borrowedLinearConstraintsMatrix; /**< Borrowed linear constraints matrix. */
+
+    /**
+     * Wrap the arrays of a compressed column major matrix in a csc struct.
+     * @param matrix is the matrix;
+     * @param osqpSparseMatrix is the csc struct. It has to be a null pointer.
+     * @return true/false in case of success/failure.
+     */
+    static bool
+    wrapOsqpSparseMatrix(const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& matrix,
+                         csc*& osqpSparseMatrix);
 
 public:
     /**
@@ -78,17 +167,67 @@ public:
 
     /**
      * Set the quadratic part of the cost function (Hessian).
-     * It is assumed to be a symmetric matrix.
+     * It is assumed to be a symmetric matrix. Only its upper triangular part is copied.
      * @param hessianMatrix is the Hessian matrix.
+     * @param isUpperTriangular if true the matrix is assumed to contain only its upper triangular
+     * part and it is copied without checking the position of the elements. OSQP rejects the
+     * matrix in Solver::initSolver() if it has elements below the diagonal.
      * @return true/false in case of success/failure.
      */
     template <typename Derived>
-    bool setHessianMatrix(const Eigen::SparseCompressedBase<Derived>& hessianMatrix);
+    bool setHessianMatrix(const Eigen::SparseCompressedBase<Derived>& hessianMatrix,
+                          bool isUpperTriangular = false);
+
+    /**
+     * Set the quadratic part of the cost function (Hessian) without copying it.
+     * The osqp matrix points directly to the arrays of the eigen matrix.
+     * @param hessianMatrix is the upper triangular part of the Hessian matrix. It has to be
+     * compressed.
+     * @note the matrix is not copied inside the library. The user has to guarantee that the
+     * matrix is neither destroyed nor modified until clearHessianMatrix() is called or the
+     * Data object is destroyed. Solver::initSolver() fails if the arrays of the matrix, which is
+     * still alive, have been reallocated. The destruction of the matrix is never detected.
+     * @return true/false in case of success/failure.
+     */
+    bool
+    borrowHessianMatrix(const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& hessianMatrix);
+
+    /**
+     * Set if the gradient and the bounds are copied inside the Data object.
+     * @param copyVectors if true setGradient(), setLowerBound() and setUpperBound() copy the
+     * vectors, otherwise only their address is stored (default behavior).
+     * @param isDoubleBuffered if true two copies of the vectors are kept. The setters fill the
+     * back copy while the front one is used by the solver, and swapVectorsBuffers() exchanges
+     * them. It is ignored if copyVectors is false.
+     * @note the gradient and the bounds have to be set again after calling this method.
+     */
+    void setVectorsCopy(bool copyVectors, bool isDoubleBuffered = false);
+
+    /**
+     * Exchange the front and the back copies of the gradient and of the bounds. After the call
+     * the OSQPData struct points to the vectors filled by the last calls of the setters.
+     * @note it must not be called while the setters are running on another thread.
+     * @return true/false in case of success/failure.
+     */
+    bool swapVectorsBuffers();
+
+    /**
+     * Verify if the gradient and the bounds are copied inside the Data object.
+     * @return true if setVectorsCopy() has been called with copyVectors equal to true.
+     */
+    bool areVectorsCopied() const;
+
+    /**
+     * Verify if the gradient and the bounds are double buffered.
+     * @return true if setVectorsCopy() has been called with both the arguments equal to true.
+     */
+    bool areVectorsDoubleBuffered() const;
 
     /**
      * Set the linear part of the cost function (Gradient).
      * @param gradientVector is the Gradient vector.
-     * @note the elements of the gradient are not copied inside the library.
+     * @note the elements of the gradient are not copied inside the library unless
+     * setVectorsCopy() is enabled.
      * The user has to guarantee that the lifetime of the object passed is the same of the
      * OsqpEigen object
      * @return true/false in case of success/failure.
@@ -106,10 +245,24 @@ public:
     bool
     setLinearConstraintsMatrix(const Eigen::SparseCompressedBase<Derived>& linearConstraintsMatrix);
 
+    /**
+     * Set the linear constraint matrix A (size m x n) without copying it.
+     * The osqp matrix points directly to the arrays of the eigen matrix.
+     * @param linearConstraintsMatrix is the linear constraints matrix A. It has to be compressed.
+     * @note the matrix is not copied inside the library. The user has to guarantee that the
+     * matrix is neither destroyed nor modified until clearLinearConstraintsMatrix() is called or
+     * the Data object is destroyed. Solver::initSolver() fails if the arrays of the matrix, which
+     * is still alive, have been reallocated. The destruction of the matrix is never detected.
+     * @return true/false in case of success/failure.
+     */
+    bool borrowLinearConstraintsMatrix(
+        const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& linearConstraintsMatrix);
+
     /**
      * Set the array for lower bound (size m).
      * @param lowerBoundVector is the lower bound constraint.
-     * @note the elements of the lowerBoundVector are not copied inside the library.
+     * @note the elements of the lowerBoundVector are not copied inside the library unless
+     * setVectorsCopy() is enabled.
      * The user has to guarantee that the lifetime of the object passed is the same of the
      * OsqpEigen object
      * @return true/false in case of success/failure.
@@ -119,7 +272,8 @@ public:
     /**
      * Set the array for upper bound (size m).
      * @param upperBoundVector is the upper bound constraint.
-     * @note the elements of the upperBoundVector are not copied inside the library.
+     * @note the elements of the upperBoundVector are not copied inside the library unless
+     * setVectorsCopy() is enabled.
      * The user has to guarantee that the lifetime of the object passed is the same of the
      * OsqpEigen object.
      * @return true/false in case of success/failure.
@@ -130,7 +284,8 @@ public:
      * Set the array for upper and lower bounds (size m).
      * @param lowerBound is the lower bound constraint.
      * @param upperBound is the upper bound constraint.
-     * @note the elements of the upperBound and lowerBound are not copied inside the library.
+     * @note the elements of the upperBound and lowerBound are not copied inside the library
+     * unless setVectorsCopy() is enabled.
      * The user has to guarantee that the lifetime of the object passed is the same of the
      * OsqpEigen object.
      * @return true/false in case of success/failure.
@@ -138,12 +293,66 @@ public:
     bool setBounds(Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> lowerBound,
                    Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> upperBound);
 
+    /**
+     * Set the linear part of the cost function (Gradient) from a vector whose scalar type is not
+     * c_float, e.g. a double vector when OSQP is compiled in single precision.
+     * @param gradientVector is the Gradient vector.
+     * @note the vector is converted once into a copy stored inside the library, hence its
+     * lifetime is not constrained. setVectorsCopy() only controls the double buffering.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    setGradient(const Eigen::MatrixBase<Derived>& gradientVector);
+
+    /**
+     * Set the array for lower bound (size m) from a vector whose scalar type is not c_float.
+     * @param lowerBoundVector is the lower bound constraint.
+     * @note the vector is converted once into a copy stored inside the library.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    setLowerBound(const Eigen::MatrixBase<Derived>& lowerBoundVector);
+
+    /**
+     * Set the array for upper bound (size m) from a vector whose scalar type is not c_float.
+     * @param upperBoundVector is the upper bound constraint.
+     * @note the vector is converted once into a copy stored inside the library.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    setUpperBound(const Eigen::MatrixBase<Derived>& upperBoundVector);
+
+    /**
+     * Set the array for upper and lower bounds (size m) from vectors whose scalar type is not
+     * c_float.
+     * @param lowerBound is the lower bound constraint.
+     * @param upperBound is the upper bound constraint.
+     * @note the vectors are converted once into copies stored inside the library.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    setBounds(const Eigen::MatrixBase<Derived>& lowerBound,
+              const Eigen::MatrixBase<Derived>& upperBound);
+
     /**
      * Get the OSQPData struct.
      * @return a const point to the OSQPData struct.
      */
     OSQPData* const& getData() const;
 
+    /**
+     * Verify if the borrowed matrices still use the arrays they had when they were borrowed.
+     * @note only the reallocation of a matrix that is still alive is detected. The borrowed
+     * matrices are read through their addresses, hence calling this method after destroying one
+     * of them is undefined behavior.
+     * @return true if the borrowed matrices have not been reallocated.
+     */
+    bool areBorrowedMatricesValid() const;
+
     /**
      * Verify if all the matrix and vectors are already set.
      * @return true if all the OSQPData struct are set.
@@ -7,45 +7,46 @@
 
 #include <iostream>
 
-#include <OsqpEigen/Debug.hpp>
+#include <OsqpEigen/Logging.hpp>
 
 template <typename Derived>
-bool OsqpEigen::Data::setHessianMatrix(const Eigen::SparseCompressedBase<Derived>& hessianMatrix)
+bool OsqpEigen::Data::setHessianMatrix(const Eigen::SparseCompressedBase<Derived>& hessianMatrix,
+                                       bool isUpperTriangular)
 {
     if (m_isHessianMatrixSet)
     {
-        debugStream() << "[OsqpEigen::Data::setHessianMatrix] The hessian matrix was already set. "
-                      << "Please use clearHessianMatrix() method to deallocate memory."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setHessianMatrix] The hessian matrix was already "
+                             "set. Please use clearHessianMatrix() method to deallocate memory.");
         return false;
     }
 
     if (!m_isNumberOfVariablesSet)
     {
-        debugStream() << "[OsqpEigen::Data::setHessianMatrix] Please set the number of variables "
-                         "before add the hessian matrix."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setHessianMatrix] Please set the number of "
+                             "variables before add the hessian matrix.");
         return false;
     }
 
     // check if the number of row and columns are equal to the number of the optimization variables
     if ((hessianMatrix.rows() != m_data->n) || (hessianMatrix.cols() != m_data->n))
     {
-        debugStream() << "[OsqpEigen::Data::setHessianMatrix] The Hessian matrix has to be a n x n "
-                         "size matrix."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setHessianMatrix] The Hessian matrix has to be a n "
+                             "x n size matrix.");
         return false;
     }
 
     // set the hessian matrix
-    //  osqp 0.6.0 required only the upper triangular part of the hessian matrix
-    Derived hessianMatrixUpperTriangular = hessianMatrix.template triangularView<Eigen::Upper>();
-    if (!OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(hessianMatrixUpperTriangular,
-                                                               m_data->P))
+    //  osqp 0.6.0 required only the upper triangular part of the hessian matrix. The lower
+    //  triangular part is skipped while the matrix is copied
+    const bool isCreated
+        = isUpperTriangular
+              ? OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(hessianMatrix, m_data->P)
+              : OsqpEigen::SparseMatrixHelper::createOsqpUpperTriangularSparseMatrix(hessianMatrix,
+                                                                                     m_data->P);
+    if (!isCreated)
     {
-        debugStream() << "[OsqpEigen::Data::setHessianMatrix] Unable to instantiate the osqp "
-                         "sparse matrix."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setHessianMatrix] Unable to instantiate the osqp "
+                             "sparse matrix.");
         return false;
     }
     m_isHessianMatrixSet = true;
@@ -58,44 +59,39 @@ bool OsqpEigen::Data::setLinearConstraintsMatrix(
 {
     if (m_isLinearConstraintsMatrixSet)
     {
-        debugStream() << "[OsqpEigen::Data::setLinearConstraintsMatrix] The linear constraint "
-                         "matrix was already set. Please use clearLinearConstraintsMatrix() method "
-                         "to deallocate memory."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setLinearConstraintsMatrix] The linear constraint "
+                             "matrix was already set. Please use clearLinearConstraintsMatrix() "
+                             "method to deallocate memory.");
         return false;
     }
 
     if (!m_isNumberOfConstraintsSet)
     {
-        debugStream() << "[OsqpEigen::Data::setLinearConstraintsMatrix] Please set the number of "
-                         "constraints before add the constraint matrix."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setLinearConstraintsMatrix] Please set the number "
+                             "of constraints before add the constraint matrix.");
         return false;
     }
 
     if (!m_isNumberOfVariablesSet)
     {
-        debugStream() << "[OsqpEigen::Data::setLinearConstraintsMatrix] Please set the number of "
-                         "variables before add the constraint matrix."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setLinearConstraintsMatrix] Please set the number "
+                             "of variables before add the constraint matrix.");
         return false;
     }
 
     if ((linearConstraintsMatrix.rows() != m_data->m)
         || (linearConstraintsMatrix.cols() != m_data->n))
     {
-        debugStream() << "[OsqpEigen::Data::setLinearConstraintsMatrix] The Linear constraints "
-                         "matrix has to be a m x n size matrix."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setLinearConstraintsMatrix] The Linear constraints "
+                             "matrix has to be a m x n size matrix.");
         return false;
     }
 
     // set the hessian matrix
     if (!OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(linearConstraintsMatrix, m_data->A))
     {
-        debugStream() << "[OsqpEigen::Data::setLinearConstraintsMatrix] osqp sparse matrix not "
-                         "created."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setLinearConstraintsMatrix] osqp sparse matrix not "
+                             "created.");
         return false;
     }
 
@@ -103,3 +99,65 @@ bool OsqpEigen::Data::setLinearConstraintsMatrix(
 
     return true;
 }
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Data::setGradient(const Eigen::MatrixBase<Derived>& gradientVector)
+{
+    if (gradientVector.rows() != m_data->n)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setGradient] The size of the gradient must be "
+                             "equal to the number of the variables.");
+        return false;
+    }
+
+    // the vector can not be borrowed, hence it is always converted in the buffer
+    writableVectorsBuffer().gradient = gradientVector.template cast<c_float>();
+    commitCopiedGradient();
+    return true;
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Data::setLowerBound(const Eigen::MatrixBase<Derived>& lowerBoundVector)
+{
+    if (lowerBoundVector.rows() != m_data->m)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setLowerBound] The size of the lower bound must be "
+                             "equal to the number of the constraints.");
+        return false;
+    }
+
+    writableVectorsBuffer().lowerBound = lowerBoundVector.template cast<c_float>();
+    commitCopiedLowerBound();
+    return true;
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Data::setUpperBound(const Eigen::MatrixBase<Derived>& upperBoundVector)
+{
+    if (upperBoundVector.rows() != m_data->m)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setUpperBound] The size of the upper bound must be "
+                             "equal to the number of the constraints.");
+        return false;
+    }
+
+    writableVectorsBuffer().upperBound = upperBoundVector.template cast<c_float>();
+    commitCopiedUpperBound();
+    return true;
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Data::setBounds(const Eigen::MatrixBase<Derived>& lowerBound,
+                           const Eigen::MatrixBase<Derived>& upperBound)
+{
+    bool ok = true;
+
+    ok = ok && this->setLowerBound(lowerBound);
+    ok = ok && this->setUpperBound(upperBound);
+
+    return ok;
+}
@@ -5,6 +5,12 @@
 
 namespace OsqpEigen
 {
+/**
+ * Get the stream where the debug messages were written. The library now logs through the
+ * functions declared in OsqpEigen/Logging.hpp, the stream is kept for compatibility.
+ * @return std::cerr if the library is compiled with OSQP_EIGEN_DEBUG_OUTPUT, a null stream
+ * otherwise.
+ */
 std::ostream& debugStream();
 } // namespace OsqpEigen
 
@@ -0,0 +1,174 @@
+/**
+ * @file EventTrace.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_EVENT_TRACE_HPP
+#define OSQPEIGEN_EVENT_TRACE_HPP
+
+// Std
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// OsqpEigen
+#include <OsqpEigen/BoundedQueue.hpp>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * Type of an event recorded by the solver.
+ */
+enum class SolverEventType : std::uint8_t
+{
+    InitSolver, /**< Call of Solver::initSolver(). */
+    HessianReinitialization, /**< Reinitialization due to a change of the hessian sparsity
+                                pattern. */
+    LinearConstraintsReinitialization, /**< Reinitialization due to a change of the linear
+                                          constraints sparsity pattern. */
+    SolveProblem /**< Call of Solver::solveProblem(). */
+};
+
+/**
+ * SolverEvent contains an event recorded by the solver. The times are expressed in nanoseconds
+ * since the epoch of std::chrono::steady_clock.
+ */
+struct SolverEvent
+{
+    SolverEventType type{SolverEventType::InitSolver}; /**< Type of the event. */
+    std::uintptr_t solver{0}; /**< Address of the solver that recorded the event. */
+    std::size_t thread{0}; /**< Hash of the id of the thread that recorded the event. */
+    std::int64_t beginTime{0}; /**< Time when the event started. */
+    std::int64_t endTime{0}; /**< Time when the event ended. */
+    int exitFlag{0}; /**< OsqpEigen::ErrorExitFlag of solveProblem(). For the other events it is
+                        zero in case of success and -1 in case of failure. */
+    int status{0}; /**< OsqpEigen::Status of solveProblem(), zero for the other events. */
+};
+
+/**
+ * Get the name of an event type.
+ * @param type is the type of the event.
+ * @return the name of the event type.
+ */
+const char* solverEventTypeName(SolverEventType type);
+
+/**
+ * EventRingBuffer is a fixed size lock-free queue of solver events. Several solvers, also running
+ * in different threads, can record events in the same buffer while another thread drains it.
+ * Recording an event neither locks nor allocates memory. If the buffer is full the new events are
+ * discarded and counted.
+ */
+class EventRingBuffer
+{
+    OsqpEigen::BoundedQueue<SolverEvent> m_queue; /**< Queue containing the events. */
+    std::atomic<std::size_t> m_droppedEvents; /**< Number of events discarded. */
+
+public:
+    /**
+     * Constructor. It allocates the memory of the buffer.
+     * @param capacity is the number of events that can be stored. It is rounded up to the next
+     * power of two.
+     */
+    explicit EventRingBuffer(std::size_t capacity);
+
+    EventRingBuffer(const EventRingBuffer&) = delete;
+    EventRingBuffer& operator=(const EventRingBuffer&) = delete;
+
+    /**
+     * Get the number of events that can be stored.
+     * @return the capacity of the buffer.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * Add an event to the buffer.
+     * @param event is the event.
+     * @return true if the event has been stored, false if the buffer is full.
+     */
+    bool push(const SolverEvent& event) noexcept;
+
+    /**
+     * Remove the oldest event from the buffer.
+     * @param event is the event removed.
+     * @return true if an event has been removed, false if the buffer is empty.
+     */
+    bool pop(SolverEvent& event) noexcept;
+
+    /**
+     * Remove all the events from the buffer and append them to a vector.
+     * @param events is the vector where the events are appended.
+     * @return the number of events removed.
+     */
+    std::size_t drain(std::vector<SolverEvent>& events);
+
+    /**
+     * Get the number of events discarded because the buffer was full.
+     * @return the number of events discarded.
+     */
+    std::size_t droppedEvents() const;
+};
+
+/**
+ * SolverEventScope class records an event in a buffer when it is destroyed. The event lasts for
+ * the lifetime of the object.
+ */
+class SolverEventScope
+{
+    EventRingBuffer* m_buffer; /**< Buffer where the event is recorded. It may be null. */
+    SolverEvent m_event; /**< Event recorded. */
+
+public:
+    /**
+     * Constructor. If the buffer is not null it stores the begin time of the event.
+     * @param buffer is the buffer where the event is recorded. If null nothing is recorded.
+     * @param type is the type of the event.
+     * @param solver is the address of the solver that records the event.
+     */
+    SolverEventScope(EventRingBuffer* buffer, SolverEventType type, const void* solver) noexcept;
+
+    /**
+     * Deconstructor. It records the event.
+     */
+    ~SolverEventScope();
+
+    /**
+     * Set the exit flag of the event.
+     * @param exitFlag is the exit flag.
+     */
+    void setExitFlag(int exitFlag) noexcept;
+
+    /**
+     * Set the status of the event.
+     * @param status is the status.
+     */
+    void setStatus(int status) noexcept;
+
+    SolverEventScope(const SolverEventScope&) = delete;
+    SolverEventScope& operator=(const SolverEventScope&) = delete;
+};
+
+/**
+ * Write the events in the Chrome trace event format. The output can be loaded in
+ * chrome://tracing or in Perfetto.
+ * @param events is the vector of events.
+ * @param stream is the output stream.
+ * @return true/false in case of success/failure.
+ */
+bool writeChromeTrace(const std::vector<SolverEvent>& events, std::ostream& stream);
+
+/**
+ * Write the events as comma separated values. The first line contains the name of the columns.
+ * @param events is the vector of events.
+ * @param stream is the output stream.
+ * @return true/false in case of success/failure.
+ */
+bool writeCsv(const std::vector<SolverEvent>& events, std::ostream& stream);
+} // namespace OsqpEigen
+
+#endif
@@ -0,0 +1,255 @@
+/**
+ * @file Logging.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_LOGGING_HPP
+#define OSQPEIGEN_LOGGING_HPP
+
+// Std
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * Level of a log message.
+ */
+enum class LogLevel : int
+{
+    Debug = 0,
+    Info = 1,
+    Warning = 2,
+    Error = 3,
+    Off = 4 /**< No message is logged. */
+};
+
+/**
+ * LogSink is the interface of the objects that write the log messages. The messages are written
+ * by a background thread, hence the sink is never called by the thread that logs the message.
+ */
+class LogSink
+{
+public:
+    /**
+     * Deconstructor.
+     */
+    virtual ~LogSink() = default;
+
+    /**
+     * Write a message.
+     * @param level is the level of the message.
+     * @param message is the null terminated message.
+     */
+    virtual void write(LogLevel level, const char* message) = 0;
+};
+
+/**
+ * StreamLogSink writes the log messages in a stream, one message per line.
+ */
+class StreamLogSink : public LogSink
+{
+    std::ostream& m_stream; /**< Stream where the messages are written. */
+
+public:
+    /**
+     * Constructor.
+     * @param stream is the stream where the messages are written. It has to outlive the sink.
+     */
+    explicit StreamLogSink(std::ostream& stream);
+
+    void write(LogLevel level, const char* message) override;
+};
+
+/**
+ * Logging namespace contains the functions used to configure the logging of the library.
+ * The messages whose level is lower than OSQP_EIGEN_LOG_MIN_LEVEL are removed at compile time.
+ * The enabled messages are formatted in a fixed size buffer and queued without locking. A
+ * background thread passes them to the sink. It is started when the logger is first used, or
+ * explicitly by start(), and it is joined by stop().
+ */
+namespace Logging
+{
+/**
+ * Maximum length of a message, including the null terminator. Longer messages are truncated.
+ */
+constexpr std::size_t maxMessageLength = 256;
+
+/**
+ * Set the sink of the messages. By default the messages are written in std::cerr.
+ * @param sink is the sink. If null the messages are discarded.
+ */
+void setSink(std::shared_ptr<LogSink> sink);
+
+/**
+ * Set the minimum level of the messages passed to the sink.
+ * @param level is the minimum level.
+ */
+void setLevel(LogLevel level);
+
+/**
+ * Get the minimum level of the messages passed to the sink.
+ * @return the minimum level.
+ */
+LogLevel getLevel();
+
+/**
+ * Check if the messages of a given level are passed to the sink.
+ * @param level is the level of the messages.
+ * @return true if the messages are passed to the sink.
+ */
+bool isLevelEnabled(LogLevel level);
+
+/**
+ * Start the background thread that writes the messages, if it is not running. Calling it at the
+ * beginning of the program avoids creating the thread when the first message is logged.
+ * @return true if the thread is running, false if it cannot be created. In this case the messages
+ * are queued until flush() is called.
+ */
+bool start();
+
+/**
+ * Stop and join the background thread, then write all the queued messages in the sink. It should
+ * be called before the end of main(), so that the thread is not joined during the destruction of
+ * the static objects. The messages logged after it are queued until start() or flush() are
+ * called.
+ */
+void stop();
+
+/**
+ * Write all the queued messages in the sink. The function blocks until the messages are written.
+ */
+void flush();
+
+/**
+ * Get the number of messages discarded because the queue was full.
+ * @return the number of messages discarded.
+ */
+std::size_t droppedMessages();
+
+/**
+ * MessageBuilder class formats a message in a fixed size buffer. The message is queued when the
+ * object is destroyed.
+ */
+class MessageBuilder
+{
+    LogLevel m_level; /**< Level of the message. */
+    std::size_t m_length; /**< Length of the message. */
+    char m_message[maxMessageLength]; /**< Null terminated message. */
+
+    /**
+     * Append a string to the message.
+     * @param string is the string.
+     * @param length is the length of the string.
+     */
+    void append(const char* string, std::size_t length) noexcept;
+
+    /**
+     * Append a number to the message.
+     * @param value is the number.
+     */
+    void appendSigned(long long value) noexcept;
+    void appendUnsigned(unsigned long long value) noexcept;
+    void appendFloating(double value) noexcept;
+
+public:
+    /**
+     * Constructor.
+     * @param level is the level of the message.
+     */
+    explicit MessageBuilder(LogLevel level) noexcept;
+
+    /**
+     * Deconstructor. It queues the message.
+     */
+    ~MessageBuilder();
+
+    MessageBuilder(const MessageBuilder&) = delete;
+    MessageBuilder& operator=(const MessageBuilder&) = delete;
+
+    MessageBuilder& operator<<(const char* string) noexcept;
+
+    MessageBuilder& operator<<(const std::string& string) noexcept;
+
+    MessageBuilder& operator<<(char character) noexcept;
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, char>::value,
+                            MessageBuilder&>::type
+    operator<<(T value) noexcept
+    {
+        if (std::is_signed<T>::value)
+            appendSigned(static_cast<long long>(value));
+        else
+            appendUnsigned(static_cast<unsigned long long>(value));
+        return *this;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, MessageBuilder&>::type
+    operator<<(T value) noexcept
+    {
+        appendFloating(static_cast<double>(value));
+        return *this;
+    }
+};
+} // namespace Logging
+} // namespace OsqpEigen
+
+// The messages below this level are removed at compile time. The level is exported by the
+// OsqpEigen target, it is 0 if the library is compiled with the OSQP_EIGEN_DEBUG_OUTPUT option,
+// otherwise 4, i.e. no message is kept. The fallback is used if the target is not linked.
+#ifndef OSQP_EIGEN_LOG_MIN_LEVEL
+#ifdef OSQP_EIGEN_DEBUG_OUTPUT
+#define OSQP_EIGEN_LOG_MIN_LEVEL 0
+#else
+#define OSQP_EIGEN_LOG_MIN_LEVEL 4
+#endif
+#endif
+
+#define OSQP_EIGEN_LOG(level, message)                                                             \
+    do                                                                                             \
+    {                                                                                              \
+        if (OsqpEigen::Logging::isLevelEnabled(level))                                             \
+        {                                                                                          \
+            OsqpEigen::Logging::MessageBuilder(level) << message;                                  \
+        }                                                                                          \
+    } while (false)
+
+#define OSQP_EIGEN_LOG_DISABLED(message)                                                           \
+    do                                                                                             \
+    {                                                                                              \
+    } while (false)
+
+#if OSQP_EIGEN_LOG_MIN_LEVEL <= 0
+#define OSQP_EIGEN_LOG_DEBUG(message) OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Debug, message)
+#else
+#define OSQP_EIGEN_LOG_DEBUG(message) OSQP_EIGEN_LOG_DISABLED(message)
+#endif
+
+#if OSQP_EIGEN_LOG_MIN_LEVEL <= 1
+#define OSQP_EIGEN_LOG_INFO(message) OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Info, message)
+#else
+#define OSQP_EIGEN_LOG_INFO(message) OSQP_EIGEN_LOG_DISABLED(message)
+#endif
+
+#if OSQP_EIGEN_LOG_MIN_LEVEL <= 2
+#define OSQP_EIGEN_LOG_WARNING(message) OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Warning, message)
+#else
+#define OSQP_EIGEN_LOG_WARNING(message) OSQP_EIGEN_LOG_DISABLED(message)
+#endif
+
+#if OSQP_EIGEN_LOG_MIN_LEVEL <= 3
+#define OSQP_EIGEN_LOG_ERROR(message) OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Error, message)
+#else
+#define OSQP_EIGEN_LOG_ERROR(message) OSQP_EIGEN_LOG_DISABLED(message)
+#endif
+
+#endif
@@ -0,0 +1,289 @@
+/**
+ * @file MPCProblemBuilder.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_MPC_PROBLEM_BUILDER_HPP
+#define OSQPEIGEN_MPC_PROBLEM_BUILDER_HPP
+
+// Std
+#include <vector>
+
+// Eigen
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+// OsqpEigen
+#include <OsqpEigen/Compat.hpp>
+#include <OsqpEigen/Data.hpp>
+#include <OsqpEigen/Solver.hpp>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * MPCProblemBuilder class builds the QP problem of a linear MPC with horizon N
+ * \f[
+ * \begin{array}{ll}
+ * \min & \sum_{k=0}^{N} (x_k - x_{ref})^\top Q_k (x_k - x_{ref}) / 2
+ *        + \sum_{k=0}^{N-1} u_k^\top R_k u_k / 2 \\
+ * \mathrm{s.t.} & x_0 = \bar{x}_0, \quad x_{k+1} = A_k x_k + B_k u_k, \\
+ * & x_{min} \le x_k \le x_{max}, \quad u_{min} \le u_k \le u_{max}.
+ * \end{array}
+ * \f]
+ * The optimization variables are ordered as \f$[x_0, \dots, x_N, u_0, \dots, u_{N-1}]\f$. The
+ * first \f$n_x (N + 1)\f$ constraints are the dynamics and the remaining ones are the bounds of
+ * the variables.
+ * The compressed-column arrays of the hessian (upper triangular part) and of the linear
+ * constraints matrix are allocated once by the constructor and written directly in the order
+ * used by OSQP. The blocks \f$A_k\f$, \f$B_k\f$, \f$Q_k\f$ and \f$R_k\f$ are stored as dense
+ * blocks, zeros included, hence changing their values never changes the sparsity pattern and a
+ * stage can be updated in place. The new values can then be passed to
+ * Solver::updateHessianValues() and Solver::updateLinearConstraintsValues().
+ */
+class MPCProblemBuilder
+{
+    int m_numberOfStates; /**< Size of the state. */
+    int m_numberOfInputs; /**< Size of the input. */
+    int m_horizon; /**< Number of stages of the horizon. */
+
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> m_hessian; /**< Upper triangular part of
+                                                                       the hessian matrix. */
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> m_linearConstraints; /**< Linear
+                                                                                 constraints
+                                                                                 matrix. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_gradient; /**< Gradient vector. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_lowerBound; /**< Lower bound vector. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_upperBound; /**< Upper bound vector. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_stateReference; /**< Reference of the state. */
+
+    /**
+     * Allocate the compressed-column arrays and set the constant entries of the matrices.
+     */
+    void buildSparsityPattern();
+
+    /**
+     * Write a symmetric block in the upper triangular part of the hessian.
+     * @param firstColumn is the index of the first column of the block.
+     * @param block is the block. Only its upper triangular part is used.
+     */
+    void setHessianBlock(
+        c_int firstColumn,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& block);
+
+    /**
+     * Evaluate the gradient of the state of a stage from its weight and the reference.
+     * @param stage is the index of the stage.
+     */
+    void updateStageGradient(int stage);
+
+    /**
+     * Check if the index of a stage is valid.
+     * @param stage is the index of the stage.
+     * @param numberOfStages is the number of stages.
+     * @param functionName is the name of the calling function used in the error message.
+     * @return true if the index is valid.
+     */
+    bool checkStage(int stage, int numberOfStages, const char* functionName) const;
+
+    /**
+     * Check the size of a matrix.
+     * @param matrix is the matrix.
+     * @param rows is the expected number of rows.
+     * @param cols is the expected number of columns.
+     * @param functionName is the name of the calling function used in the error message.
+     * @return true if the size is correct.
+     */
+    bool checkSize(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>&
+                       matrix,
+                   int rows,
+                   int cols,
+                   const char* functionName) const;
+
+public:
+    /**
+     * Constructor. It allocates all the memory of the problem. The matrices are zero, the bounds
+     * are infinite and the initial state is zero.
+     * @param numberOfStates is the size of the state.
+     * @param numberOfInputs is the size of the input.
+     * @param horizon is the number of stages of the horizon.
+     */
+    MPCProblemBuilder(int numberOfStates, int numberOfInputs, int horizon);
+
+    /**
+     * Get the number of variables of the QP problem, i.e. \f$n_x (N + 1) + n_u N\f$.
+     * @return the number of variables.
+     */
+    int getNumberOfVariables() const;
+
+    /**
+     * Get the number of constraints of the QP problem, i.e. \f$n_x (N + 1)\f$ plus the number
+     * of variables.
+     * @return the number of constraints.
+     */
+    int getNumberOfConstraints() const;
+
+    /**
+     * Set the dynamics of all the stages.
+     * @param A is the state matrix (nx x nx).
+     * @param B is the input matrix (nx x nu).
+     * @return true/false in case of success/failure.
+     */
+    bool setDynamics(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& A,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& B);
+
+    /**
+     * Set the dynamics of a single stage, e.g. for a time varying linearization.
+     * @param stage is the index of the stage, between 0 and N - 1.
+     * @param A is the state matrix (nx x nx).
+     * @param B is the input matrix (nx x nu).
+     * @return true/false in case of success/failure.
+     */
+    bool setStageDynamics(
+        int stage,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& A,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& B);
+
+    /**
+     * Set the weights of all the stages. The terminal state is weighted with Q.
+     * @param Q is the symmetric weight of the state (nx x nx). Only its upper triangular part is
+     * used.
+     * @param R is the symmetric weight of the input (nu x nu). Only its upper triangular part is
+     * used.
+     * @return true/false in case of success/failure.
+     */
+    bool setWeights(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& Q,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& R);
+
+    /**
+     * Set the weight of the state of a single stage.
+     * @param stage is the index of the stage, between 0 and N. The stage N is the terminal one.
+     * @param Q is the symmetric weight of the state (nx x nx). Only its upper triangular part is
+     * used.
+     * @return true/false in case of success/failure.
+     */
+    bool setStageStateWeight(
+        int stage,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& Q);
+
+    /**
+     * Set the weight of the input of a single stage.
+     * @param stage is the index of the stage, between 0 and N - 1.
+     * @param R is the symmetric weight of the input (nu x nu). Only its upper triangular part is
+     * used.
+     * @return true/false in case of success/failure.
+     */
+    bool setStageInputWeight(
+        int stage,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& R);
+
+    /**
+     * Set the bounds of the state of all the stages.
+     * @param stateMin is the lower bound of the state.
+     * @param stateMax is the upper bound of the state.
+     * @return true/false in case of success/failure.
+     */
+    bool setStateBounds(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& stateMin,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& stateMax);
+
+    /**
+     * Set the bounds of the input of all the stages.
+     * @param inputMin is the lower bound of the input.
+     * @param inputMax is the upper bound of the input.
+     * @return true/false in case of success/failure.
+     */
+    bool setInputBounds(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& inputMin,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& inputMax);
+
+    /**
+     * Set the initial state of the horizon.
+     * @param initialState is the initial state.
+     * @return true/false in case of success/failure.
+     */
+    bool setInitialState(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& initialState);
+
+    /**
+     * Set the reference of the state. The gradient is evaluated again for all the stages.
+     * @param stateReference is the reference of the state.
+     * @return true/false in case of success/failure.
+     */
+    bool setStateReference(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& stateReference);
+
+    /**
+     * Get the upper triangular part of the hessian matrix.
+     * @return a const reference to the compressed hessian matrix.
+     */
+    const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& getHessianMatrix() const;
+
+    /**
+     * Get the linear constraints matrix.
+     * @return a const reference to the compressed linear constraints matrix.
+     */
+    const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& getLinearConstraintsMatrix() const;
+
+    /**
+     * Get the non zero values of the upper triangular part of the hessian matrix in
+     * compressed-column order. They can be passed to Solver::updateHessianValues().
+     * @return a map to the values.
+     */
+    Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>> getHessianValues() const;
+
+    /**
+     * Get the non zero values of the linear constraints matrix in compressed-column order. They
+     * can be passed to Solver::updateLinearConstraintsValues().
+     * @return a map to the values.
+     */
+    Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>> getLinearConstraintsValues() const;
+
+    /**
+     * Get the gradient vector.
+     * @return a const reference to the gradient.
+     */
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& getGradient() const;
+
+    /**
+     * Get the lower bound vector.
+     * @return a const reference to the lower bound.
+     */
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& getLowerBound() const;
+
+    /**
+     * Get the upper bound vector.
+     * @return a const reference to the upper bound.
+     */
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& getUpperBound() const;
+
+    /**
+     * Get the stages of the primal vector, i.e. the states and the inputs.
+     * @return the blocks to be passed to Solver::warmStartShifted().
+     */
+    std::vector<OsqpEigen::StageBlock> getPrimalStageBlocks() const;
+
+    /**
+     * Get the stages of the dual vector, i.e. the dynamics, the bounds of the states and the
+     * bounds of the inputs.
+     * @return the blocks to be passed to Solver::warmStartShifted().
+     */
+    std::vector<OsqpEigen::StageBlock> getDualStageBlocks() const;
+
+    /**
+     * Set the problem in a Data object. The matrices are borrowed and the vectors are passed by
+     * address, hence no copy is performed.
+     * @param data is the Data object. Its hessian and linear constraints matrices must not be set.
+     * @note the builder has to outlive the Data object and must not be moved.
+     * @return true/false in case of success/failure.
+     */
+    bool setSolverData(OsqpEigen::Data& data);
+};
+} // namespace OsqpEigen
+
+#endif
@@ -7,10 +7,19 @@
 #ifndef OSQPEIGEN_OSQPEIGEN_H
 #define OSQPEIGEN_OSQPEIGEN_H
 
+#include <OsqpEigen/AsyncSolveWorker.hpp>
+#include <OsqpEigen/BatchSolver.hpp>
 #include <OsqpEigen/Constants.hpp>
 #include <OsqpEigen/Data.hpp>
+#include <OsqpEigen/EventTrace.hpp>
+#include <OsqpEigen/Logging.hpp>
+#include <OsqpEigen/MPCProblemBuilder.hpp>
+#include <OsqpEigen/PortfolioSolver.hpp>
+#include <OsqpEigen/RealTime.hpp>
 #include <OsqpEigen/Settings.hpp>
 #include <OsqpEigen/Solver.hpp>
+#include <OsqpEigen/SolverPool.hpp>
+#include <OsqpEigen/SolverStats.hpp>
 #include <OsqpEigen/SparseMatrixHelper.hpp>
 
 #endif // OSQPEIGEN_OSQPEIGEN_H
@@ -0,0 +1,193 @@
+/**
+ * @file PortfolioSolver.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_PORTFOLIO_SOLVER_HPP
+#define OSQPEIGEN_PORTFOLIO_SOLVER_HPP
+
+// Std
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Eigen
+#include <Eigen/Dense>
+
+// OsqpEigen
+#include <OsqpEigen/Compat.hpp>
+#include <OsqpEigen/Constants.hpp>
+#include <OsqpEigen/Data.hpp>
+#include <OsqpEigen/Settings.hpp>
+#include <OsqpEigen/Solver.hpp>
+#include <OsqpEigen/ThreadPool.hpp>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * PortfolioSolver class solves the same QP problem with different settings, e.g. a grid of
+ * values of rho or the adaptive rho enabled and disabled. Each settings profile owns an OSQP
+ * workspace and the profiles are solved concurrently by a pool of threads. The first profile
+ * reaching Status::Solved is the winner, then the other profiles are cancelled with
+ * Solver::solveProblem(const std::atomic<bool>&).
+ * The problem is the one set in the Data object returned by data().
+ */
+class PortfolioSolver
+{
+    bool m_isSolverInitialized; /**< Boolean true if solver is initialized. */
+    std::vector<std::unique_ptr<OsqpEigen::Settings>> m_settings; /**< Settings of each profile. */
+    std::unique_ptr<OsqpEigen::Data> m_data; /**< Data shared by all the profiles. */
+    std::vector<std::unique_ptr<OsqpEigen::Solver>> m_solvers; /**< One solver per profile. */
+    std::unique_ptr<OsqpEigen::ThreadPool> m_threadPool; /**< Pool solving the profiles. */
+    std::atomic<bool> m_isSolved; /**< Set by the winner to cancel the other profiles. */
+    std::atomic<int> m_winner; /**< Index of the profile that solved the problem first. */
+
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_gradient; /**< Gradient vector. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_lowerBound; /**< Lower bound vector. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_upperBound; /**< Upper bound vector. */
+
+    /**
+     * PendingUpdates struct contains the data of a profile that have not been sent to its solver
+     * yet.
+     */
+    struct PendingUpdates
+    {
+        bool isGradientToUpdate{false}; /**< Boolean true if the gradient has to be sent. */
+        bool areBoundsToUpdate{false}; /**< Boolean true if the bounds have to be sent. */
+    };
+    std::vector<PendingUpdates> m_pendingUpdates; /**< Pending updates of each profile. */
+
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_solution; /**< Primal solution. */
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_dualSolution; /**< Dual solution. */
+    std::vector<OsqpEigen::ErrorExitFlag> m_errorExitFlags; /**< Error flag of each profile. */
+    std::vector<OsqpEigen::Status> m_status; /**< Status of each profile. */
+
+public:
+    /**
+     * Constructor.
+     */
+    PortfolioSolver();
+
+    /**
+     * Add a settings profile. The profile is initialized with the default settings.
+     * @note the profiles can be added only before initSolver().
+     * @return the pointer to the Settings object of the new profile.
+     */
+    const std::unique_ptr<OsqpEigen::Settings>& addProfile();
+
+    /**
+     * Get the number of settings profiles.
+     * @return the number of profiles.
+     */
+    int getNumberOfProfiles() const;
+
+    /**
+     * Initialize a solver for each profile with the data and the settings of the profile.
+     * @param numberOfThreads is the number of threads solving the profiles. If it is equal to
+     * zero one thread per profile is used. With less threads than profiles some profiles are
+     * started only when another one is completed.
+     * @return true/false in case of success/failure.
+     */
+    bool initSolver(int numberOfThreads = 0);
+
+    /**
+     * Check if the solver is initialized.
+     * @return true if the solver is initialized.
+     */
+    bool isInitialized() const;
+
+    /**
+     * Deallocate memory.
+     */
+    void clearSolver();
+
+    /**
+     * Update the linear part of the cost function (Gradient) of all the profiles.
+     * @param gradient is the gradient vector.
+     * @note the gradient is copied and sent to the solvers in solveProblem().
+     * @return true/false in case of success/failure.
+     */
+    bool
+    updateGradient(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& gradient);
+
+    /**
+     * Update both upper and lower bounds of all the profiles.
+     * @param lowerBound is the lower bound constraint vector;
+     * @param upperBound is the upper bound constraint vector.
+     * @note the bounds are copied and sent to the solvers in solveProblem().
+     * @return true/false in case of success/failure.
+     */
+    bool updateBounds(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound,
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound);
+
+    /**
+     * Solve the QP problem with all the profiles concurrently. Each profile is warm started from
+     * its previous iterate.
+     * @note if the data cannot be sent to the solver of a profile, the profile is not solved and
+     * its error exit flag is DataValidationError. The data that have not been sent are sent again
+     * by the next call, unless they are replaced by an update.
+     * @return NoError if a profile solved the problem or if the first profile completed without
+     * errors, otherwise the error exit flag of the first profile.
+     */
+    OsqpEigen::ErrorExitFlag solveProblem();
+
+    /**
+     * Get the profile that solved the problem first.
+     * @return the index of the profile, -1 if no profile reached Status::Solved.
+     */
+    int getWinner() const;
+
+    /**
+     * Get the status of the solution. It is Status::Solved if a profile solved the problem,
+     * otherwise the status of the first profile.
+     * @return the status of the solution.
+     */
+    OsqpEigen::Status getStatus() const;
+
+    /**
+     * Get the error exit flag of each profile.
+     * @return a vector containing the error exit flag of each profile.
+     */
+    const std::vector<OsqpEigen::ErrorExitFlag>& getErrorExitFlags() const;
+
+    /**
+     * Get the status of each profile. The cancelled profiles have Status::Sigint.
+     * @return a vector containing the status of each profile.
+     */
+    const std::vector<OsqpEigen::Status>& getProfilesStatus() const;
+
+    /**
+     * Get the primal solution of the winner, or of the first profile if no profile solved the
+     * problem.
+     * @return a const reference to the solution.
+     */
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& getSolution() const;
+
+    /**
+     * Get the dual solution of the winner, or of the first profile if no profile solved the
+     * problem.
+     * @return a const reference to the dual solution.
+     */
+    const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& getDualSolution() const;
+
+    /**
+     * Get the settings of a profile.
+     * @param profile is the index of the profile.
+     * @return the pointer to Settings object.
+     */
+    const std::unique_ptr<OsqpEigen::Settings>& settings(int profile) const;
+
+    /**
+     * Get the data shared by all the profiles.
+     * @return the pointer to Data object.
+     */
+    const std::unique_ptr<OsqpEigen::Data>& data() const;
+};
+} // namespace OsqpEigen
+
+#endif
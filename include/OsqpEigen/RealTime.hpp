@@ -0,0 +1,92 @@
+/**
+ * @file RealTime.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_REAL_TIME_HPP
+#define OSQPEIGEN_REAL_TIME_HPP
+
+// Std
+#include <cstddef>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * RealTime namespace contains the utilities used to check that the hot path of the solver does
+ * not allocate memory.
+ * The allocations are tracked only if the library is compiled with the
+ * OSQP_EIGEN_REAL_TIME_CHECKS CMake option and the executable links the OsqpEigenRealTimeChecks
+ * object library, which replaces the global operator new and, with glibc, the malloc family. In
+ * this case every allocation performed by a thread inside a HotPathScope is counted, including the
+ * buffers of the dense Eigen objects and the memory allocated by OSQP.
+ * @note on the platforms without glibc only the global operator new is replaced, hence the
+ * allocations performed through malloc, by OSQP or by the Eigen aligned allocator, are not
+ * tracked.
+ */
+namespace RealTime
+{
+/**
+ * Check if the library has been compiled with the allocation tracking.
+ * @return true if the OSQP_EIGEN_REAL_TIME_CHECKS option is enabled.
+ */
+bool isAllocationTrackingEnabled();
+
+/**
+ * Get the number of heap allocations performed by the calling thread inside a HotPathScope since
+ * the last call of resetAllocationCount().
+ * @return the number of allocations. It is always zero if the tracking is not enabled.
+ */
+std::size_t getAllocationCount();
+
+/**
+ * Reset the number of heap allocations performed by the calling thread.
+ */
+void resetAllocationCount();
+
+/**
+ * Set if the program has to be aborted when a heap allocation is performed inside a
+ * HotPathScope.
+ * @param abortOnAllocation if true the program is aborted.
+ */
+void setAbortOnAllocation(bool abortOnAllocation);
+
+/**
+ * Count a heap allocation performed by the calling thread if it is inside a HotPathScope. It is
+ * called by the allocation functions replaced in the OsqpEigenRealTimeChecks object library.
+ */
+void recordAllocation();
+
+/**
+ * HotPathScope class marks the lifetime of the object as part of the hot path. The scopes can be
+ * nested.
+ */
+class HotPathScope
+{
+public:
+    /**
+     * Constructor. It enters the hot path.
+     */
+    HotPathScope();
+
+    /**
+     * Deconstructor. It exits the hot path.
+     */
+    ~HotPathScope();
+
+    HotPathScope(const HotPathScope&) = delete;
+    HotPathScope& operator=(const HotPathScope&) = delete;
+};
+} // namespace RealTime
+} // namespace OsqpEigen
+
+#ifdef OSQP_EIGEN_REAL_TIME_CHECKS
+#define OSQP_EIGEN_HOT_PATH_SCOPE const OsqpEigen::RealTime::HotPathScope osqpEigenHotPathScope
+#else
+#define OSQP_EIGEN_HOT_PATH_SCOPE
+#endif
+
+#endif
@@ -8,7 +8,13 @@
 #define OSQPEIGEN_SOLVER_HPP
 
 // Std
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 // Eigen
 #include <Eigen/Dense>
@@ -17,22 +23,41 @@
 #include <osqp.h>
 
 // OsqpEigen
+#include <OsqpEigen/AsyncSolveWorker.hpp>
 #include <OsqpEigen/Compat.hpp>
 #include <OsqpEigen/Constants.hpp>
 #include <OsqpEigen/Data.hpp>
+#include <OsqpEigen/EventTrace.hpp>
+#include <OsqpEigen/RealTime.hpp>
 #include <OsqpEigen/Settings.hpp>
+#include <OsqpEigen/SolverStats.hpp>
 
 /**
  * OsqpEigen namespace.
  */
 namespace OsqpEigen
 {
+/**
+ * StageBlock describes a part of the primal or of the dual vector made of consecutive stages of
+ * the same size, e.g. the states or the inputs of an MPC horizon.
+ */
+struct StageBlock
+{
+    c_int numberOfStages; /**< Number of stages of the block. */
+    c_int stageSize; /**< Number of elements of each stage. */
+};
+
 /**
  * Solver class is a wrapper of the OSQP OSQPWorkspace struct.
  */
 class Solver
 {
     bool m_isSolverInitialized; /**< Boolean true if solver is initialized. */
+    bool m_isSparsityPatternSuperset; /**< Boolean true if the sparsity pattern of the matrices
+                                         set in initSolver() is the maximal one. */
+    bool m_isRealTimeModeEnabled; /**< Boolean true if the scratch memory is reserved in
+                                     initSolver(). */
+    int m_asyncWorkerCpu; /**< CPU of the asynchronous solve worker, -1 if it is not pinned. */
 #ifdef OSQP_EIGEN_OSQP_IS_V1
     std::unique_ptr<OSQPSolver, std::function<void(OSQPSolver*)>> m_solver; /**< Pointer to
                                                                                OSQPSolver struct. */
@@ -43,22 +68,50 @@ class Solver
 #endif
     std::unique_ptr<OsqpEigen::Settings> m_settings; /**< Pointer to Settings class. */
     std::unique_ptr<OsqpEigen::Data> m_data; /**< Pointer to Data class. */
+    OsqpEigen::SolverStats m_stats; /**< Timing and counters of the solver. */
+    std::shared_ptr<OsqpEigen::EventRingBuffer> m_eventRingBuffer; /**< Buffer where the events
+                                                                      are recorded. */
     Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_primalVariables;
     Eigen::Matrix<c_float, Eigen::Dynamic, 1> m_dualVariables;
     Eigen::Matrix<c_float, -1, 1> m_solution;
     Eigen::Matrix<c_float, -1, 1> m_dualSolution;
+    Eigen::Matrix<c_float, -1, 1> m_bestPrimalIterate; /**< Primal iterate with the smallest
+                                                          residuals of a chunked solve. */
+    Eigen::Matrix<c_float, -1, 1> m_bestDualIterate; /**< Dual iterate with the smallest residuals
+                                                        of a chunked solve. */
+    Eigen::Matrix<c_float, -1, 1> m_convertedGradient; /**< Gradient converted to c_float. */
+    Eigen::Matrix<c_float, -1, 1> m_convertedLowerBound; /**< Lower bound converted to c_float. */
+    Eigen::Matrix<c_float, -1, 1> m_convertedUpperBound; /**< Upper bound converted to c_float. */
 
     std::vector<c_int> m_hessianNewIndices;
     std::vector<c_float> m_hessianNewValues;
 
+    std::vector<c_int> m_hessianOuterIndex; /**< Cached column pointers of the upper triangular
+                                               hessian matrix. */
+    std::vector<c_int> m_hessianInnerIndex; /**< Cached row indices of the upper triangular hessian
+                                               matrix. */
+    std::vector<c_float> m_hessianValues; /**< Values of the hessian matrix stored in the solver. */
+
     std::vector<c_int> m_constraintsNewIndices;
     std::vector<c_float> m_constraintsNewValues;
 
+    std::vector<c_int> m_constraintsOuterIndex; /**< Cached column pointers of the linear
+                                                   constraints matrix. */
+    std::vector<c_int> m_constraintsInnerIndex; /**< Cached row indices of the linear constraints
+                                                   matrix. */
+    std::vector<c_float> m_constraintsValues; /**< Values of the linear constraints matrix stored
+                                                 in the solver. */
+
     std::vector<Eigen::Triplet<c_float>> m_oldHessianTriplet, m_newHessianTriplet,
         m_newUpperTriangularHessianTriplets;
     std::vector<Eigen::Triplet<c_float>> m_oldLinearConstraintsTriplet,
         m_newLinearConstraintsTriplet;
 
+    // declared last, so that the pending asynchronous solves are completed before the workspace
+    // is deallocated
+    std::unique_ptr<OsqpEigen::AsyncSolveWorker> m_asyncWorker; /**< Worker running the
+                                                                   asynchronous solves. */
+
     /**
      * Evaluate the position and the values of the new elements of a sparse matrix.
      * @param oldMatrixTriplet vector containing the triplets of the old sparse matrix;
@@ -74,6 +127,91 @@ class Solver
                            std::vector<c_int>& newIndices,
                            std::vector<c_float>& newValues) const;
 
+    /**
+     * Evaluate the position and the values of the new elements of a column major sparse matrix.
+     * The matrix is compared column by column against a cached compressed-column sparsity
+     * pattern, hence no triplets are evaluated.
+     * @param newMatrix is the new sparse matrix;
+     * @param outerIndex vector containing the column pointers of the cached matrix;
+     * @param innerIndex vector containing the row indices of the cached matrix;
+     * @param oldValues vector containing the values of the cached matrix;
+     * @param isUpperTriangular if true only the upper triangular part of newMatrix is considered;
+     * @param isSuperset if true the cached sparsity pattern is considered as a superset of the
+     * new one and the cached elements missing in newMatrix are set to zero;
+     * @param newIndices vector of the index mapping new elements
+     * to position in the sparse matrix;
+     * @param newValues vector of new elements in the sparse matrix.
+     * @note newIndices and newValues should have a capacity equal to the number of non zeros of
+     * the cached matrix, otherwise memory may be allocated.
+     * @return true if the sparsity pattern is not changed false otherwise.
+     */
+    template <typename Derived>
+    bool evaluateNewValues(const Eigen::SparseCompressedBase<Derived>& newMatrix,
+                           const std::vector<c_int>& outerIndex,
+                           const std::vector<c_int>& innerIndex,
+                           const std::vector<c_float>& oldValues,
+                           bool isUpperTriangular,
+                           bool isSuperset,
+                           std::vector<c_int>& newIndices,
+                           std::vector<c_float>& newValues) const;
+
+    /**
+     * Send to the workspace the gradient and the bounds queued during an asynchronous solve.
+     * @return true/false in case of success/failure.
+     */
+    bool applyQueuedUpdates();
+
+    /**
+     * Reserve the memory of all the vectors used by the update methods, so that they do not
+     * allocate memory as long as the sparsity patterns of the matrices do not change.
+     */
+    void reserveScratchMemory();
+
+    /**
+     * Copy the information reported by OSQP into the statistics of the solver.
+     * @param isSolveCompleted if true the information of the last solve are copied as well.
+     */
+    void collectOsqpInfoStats(const bool isSolveCompleted);
+
+    /**
+     * Store the sparsity pattern and the values of the hessian matrix passed to the solver.
+     */
+    void cacheHessianMatrix();
+
+    /**
+     * Store the sparsity pattern and the values of the linear constraints matrix passed to the
+     * solver.
+     */
+    void cacheLinearConstraintsMatrix();
+
+    /**
+     * Get the gradient and the bounds stored in the solver. With OSQP v0.6 they are read from the
+     * workspace and unscaled, with OSQP v1 they are the ones stored in Data, since the workspace
+     * is not accessible.
+     * @param gradient is the gradient (size n);
+     * @param lowerBound is the lower bound (size m);
+     * @param upperBound is the upper bound (size m).
+     */
+    void getSolverVectors(Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> gradient,
+                          Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> lowerBound,
+                          Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> upperBound) const;
+
+    /**
+     * Evaluate the triplets of a matrix cached in initSolver(). The values are the ones stored in
+     * the solver, hence they take into account the updates performed after initSolver().
+     * @param rows is the number of rows of the matrix;
+     * @param outerIndex vector containing the column pointers of the cached matrix;
+     * @param innerIndex vector containing the row indices of the cached matrix;
+     * @param values vector containing the values of the cached matrix;
+     * @param triplets vector containing the triplets of the matrix.
+     * @return true/false in case of success/failure.
+     */
+    bool cachedMatrixToTriplets(const c_int rows,
+                                const std::vector<c_int>& outerIndex,
+                                const std::vector<c_int>& innerIndex,
+                                const std::vector<c_float>& values,
+                                std::vector<Eigen::Triplet<c_float>>& triplets) const;
+
     /**
      * Takes only the triplets which belongs to the upper triangular part of the matrix.
      * @param fullMatrixTriplets vector containing the triplets of the sparse matrix;
@@ -148,6 +286,71 @@ public:
      */
     void clearSolver();
 
+    /**
+     * Set if the sparsity pattern of the hessian and linear constraints matrices set in Data when
+     * initSolver() is called has to be considered the maximal one. Explicit zeros can be stored
+     * in the matrices to declare elements that may appear in future updates.
+     * If true, updateHessianMatrix() and updateLinearConstraintsMatrix() accept matrices whose
+     * sparsity pattern is contained in the maximal one: the missing elements are set to zero and
+     * only the values are updated, without reinitializing the solver.
+     * @param isSuperset if true the sparsity pattern set in initSolver() is the maximal one.
+     * @note If a matrix containing an element outside the maximal sparsity pattern is passed, the
+     * solver is reinitialized and the sparsity pattern of the new matrix becomes the maximal one.
+     */
+    void setSparsityPatternSuperset(const bool isSuperset);
+
+    /**
+     * Check if the sparsity pattern set in initSolver() is considered the maximal one.
+     * @return true if the sparsity pattern is considered the maximal one.
+     */
+    bool isSparsityPatternSuperset() const;
+
+    /**
+     * Set the real time mode. If enabled, initSolver() reserves the memory of all the vectors
+     * used by the update methods. Then the update methods and solveProblem() do not allocate
+     * memory as long as the sparsity patterns of the matrices do not change and the vectors
+     * passed are Eigen column vectors of c_float.
+     * @param isEnabled if true the real time mode is enabled.
+     * @note it has to be called before initSolver(). If the library is compiled with the
+     * OSQP_EIGEN_REAL_TIME_CHECKS option, the allocations performed by the update methods and
+     * by solveProblem() can be inspected with the functions in the OsqpEigen::RealTime namespace.
+     */
+    void setRealTimeMode(const bool isEnabled);
+
+    /**
+     * Check if the real time mode is enabled.
+     * @return true if the real time mode is enabled.
+     */
+    bool isRealTimeModeEnabled() const;
+
+    /**
+     * Get the timing and the counters collected by initSolver(), by the update methods and by
+     * solveProblem().
+     * @return a const reference to the statistics of the solver.
+     * @note the statistics are collected only if the library is compiled with the
+     * OSQP_EIGEN_SOLVER_STATS option, see SolverStats::isEnabled().
+     */
+    const OsqpEigen::SolverStats& stats() const;
+
+    /**
+     * Set to zero all the statistics of the solver.
+     */
+    void resetStats();
+
+    /**
+     * Set the buffer where the solver records its events: the calls of initSolver() and
+     * solveProblem() and the reinitializations due to a change of the sparsity pattern.
+     * The same buffer can be shared by several solvers.
+     * @param buffer is the buffer. If null the events are not recorded.
+     */
+    void setEventRingBuffer(std::shared_ptr<OsqpEigen::EventRingBuffer> buffer);
+
+    /**
+     * Get the buffer where the solver records its events.
+     * @return a const reference to the pointer to the buffer. It is null if not set.
+     */
+    const std::shared_ptr<OsqpEigen::EventRingBuffer>& eventRingBuffer() const;
+
     /**
      * Set to zero all the solver variables.
      * @return true/false in case of success/failure.
@@ -166,6 +369,68 @@ public:
      */
     OsqpEigen::ErrorExitFlag solveProblem();
 
+    /**
+     * Solve the QP optimization problem checking a cancellation flag between the ADMM iterations.
+     * The iterations are run in chunks, each one warm started from the last iterate of the
+     * previous one. A chunk contains a whole number of termination checks and rho updates, hence
+     * they happen at the same iterations of solveProblem(). If the adaptive rho interval is zero,
+     * i.e. osqp chooses it from the setup time, the chunks use the interval chosen by osqp when
+     * the time is not measured, i.e. a multiple of the termination check interval.
+     * @param cancel is the flag checked before each chunk. It can be set by another thread.
+     * @note it is equivalent to solveProblem(std::chrono::steady_clock::time_point::max(),
+     * &cancel).
+     * @return the error exit flag
+     */
+    OsqpEigen::ErrorExitFlag solveProblem(const std::atomic<bool>& cancel);
+
+    /**
+     * Solve the QP optimization problem before a deadline, checking a cancellation flag between
+     * the ADMM iterations. The iterations are run in chunks as in
+     * solveProblem(const std::atomic<bool>&). If OSQP is compiled with profiling the chunk
+     * running when the deadline is reached is stopped by the OSQP time limit, otherwise the
+     * deadline is checked between the chunks.
+     * @param deadline is the time after which the solve is stopped;
+     * @param cancel is the flag checked before each chunk, it can be set by another thread. If
+     * it is a null pointer the solve can not be cancelled.
+     * @note if the solve is cancelled the status is Status::Sigint, if the deadline is reached
+     * it is Status::TimeLimitReached. If the solve does not converge the solution contains the
+     * iterate having the smallest residuals, while the next solve is warm started from the last
+     * one. If the solve is stopped before the first chunk no iteration is run, hence the primal
+     * and the dual solutions are the last ones available, i.e. the ones of the previous solve.
+     * @return the error exit flag
+     */
+    OsqpEigen::ErrorExitFlag solveProblem(const std::chrono::steady_clock::time_point deadline,
+                                          const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * Solve the QP optimization problem on a worker thread owned by the solver. The worker is
+     * started by the first call and the solves are run in the order they are submitted.
+     * While a solve is pending the gradient and the bounds can be updated by the calling thread:
+     * the updates are queued and sent together to the workspace before the next solve. A queued
+     * bound is checked against the queued opposite bound, hence the update fails if the lower
+     * bound is greater than the upper bound. The other methods must not be called, and the solver
+     * must not be moved, until the future is ready.
+     * @param onCompletion is called by the worker thread with the error exit flag when the solve
+     * is completed. It can be empty. It can update and initialize the solver again, e.g. with
+     * clearSolver() or with a matrix update that changes the sparsity pattern: in this case the
+     * worker is kept, the solves submitted later run on the new workspace. It must not destroy
+     * or move the solver, and it must not wait for the future of a solve of the same solver,
+     * since the worker thread would wait for itself.
+     * @return the future that gets the error exit flag of the solve, or the exception thrown by
+     * onCompletion.
+     */
+    std::future<OsqpEigen::ErrorExitFlag>
+    solveAsync(std::function<void(OsqpEigen::ErrorExitFlag)> onCompletion = nullptr);
+
+    /**
+     * Pin the thread running the asynchronous solves to a CPU.
+     * @param cpu is the index of the CPU. If the worker is not started yet it is pinned when it
+     * is started by solveAsync().
+     * @note it is supported only on Linux.
+     * @return true/false in case of success/failure.
+     */
+    bool setAsyncWorkerCpuAffinity(const int cpu);
+
     /**
      * Get the status of the solver
      * @return The inner solver status
@@ -190,6 +455,93 @@ public:
      */
     const Eigen::Matrix<c_float, -1, 1>& getDualSolution();
 
+    /**
+     * Get the sparsity pattern of the upper triangular hessian matrix stored in the solver.
+     * @param outerIndex is the vector where the column pointers are copied;
+     * @param innerIndex is the vector where the row indices are copied.
+     * @note the pattern is cached by initSolver(), hence it does not depend on the lifetime of
+     * the matrices set in Data.
+     * @return true/false in case of success/failure.
+     */
+    bool getHessianSparsityPattern(std::vector<c_int>& outerIndex,
+                                   std::vector<c_int>& innerIndex) const;
+
+    /**
+     * Get the sparsity pattern of the linear constraints matrix stored in the solver.
+     * @param outerIndex is the vector where the column pointers are copied;
+     * @param innerIndex is the vector where the row indices are copied.
+     * @note the pattern is cached by initSolver(), hence it does not depend on the lifetime of
+     * the matrices set in Data.
+     * @return true/false in case of success/failure.
+     */
+    bool getLinearConstraintsSparsityPattern(std::vector<c_int>& outerIndex,
+                                             std::vector<c_int>& innerIndex) const;
+
+    /**
+     * Replace the matrices and the vectors set in Data with copies of the ones stored in the
+     * solver. Data then copies the vectors, as after Data::setVectorsCopy(true), hence it does not
+     * refer to any memory owned by the caller.
+     * @note with OSQP v1 the vectors are read from Data, since the workspace is not accessible,
+     * hence the vectors set in Data have to be alive.
+     * @return true/false in case of success/failure.
+     */
+    bool detachData();
+
+    /**
+     * Get a view of the optimization problem solution stored in the osqp workspace.
+     * @note the view does not allocate memory. It is valid until the solver is cleared and its
+     * content changes when the problem is solved again.
+     * @return an Eigen::Map pointing to the solution. It is empty if the solver is not
+     * initialized.
+     */
+    Eigen::Map<const Eigen::Matrix<c_float, -1, 1>> solutionView() const;
+
+    /**
+     * Get a view of the dual optimization problem solution stored in the osqp workspace.
+     * @note the view does not allocate memory. It is valid until the solver is cleared and its
+     * content changes when the problem is solved again.
+     * @return an Eigen::Map pointing to the dual solution. It is empty if the solver is not
+     * initialized.
+     */
+    Eigen::Map<const Eigen::Matrix<c_float, -1, 1>> dualSolutionView() const;
+
+    /**
+     * Copy the optimization problem solution in a vector without allocating memory.
+     * @param solution is the vector where the solution is copied. Its size has to be equal to
+     * the number of variables.
+     * @return true/false in case of success/failure.
+     */
+    bool copySolutionTo(Eigen::Ref<Eigen::Matrix<c_float, -1, 1>> solution) const;
+
+    /**
+     * Copy the dual optimization problem solution in a vector without allocating memory.
+     * @param dualSolution is the vector where the dual solution is copied. Its size has to be
+     * equal to the number of constraints.
+     * @return true/false in case of success/failure.
+     */
+    bool copyDualSolutionTo(Eigen::Ref<Eigen::Matrix<c_float, -1, 1>> dualSolution) const;
+
+    /**
+     * Copy the optimization problem solution in a vector whose scalar type is not c_float, e.g.
+     * a double vector when OSQP is compiled in single precision.
+     * @param solution is the vector where the converted solution is copied. Its size has to be
+     * equal to the number of variables.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    copySolutionTo(Eigen::MatrixBase<Derived>& solution) const;
+
+    /**
+     * Copy the dual optimization problem solution in a vector whose scalar type is not c_float.
+     * @param dualSolution is the vector where the converted dual solution is copied. Its size
+     * has to be equal to the number of constraints.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    copyDualSolutionTo(Eigen::MatrixBase<Derived>& dualSolution) const;
+
     /**
      * Update the linear part of the cost function (Gradient).
      * @param gradient is the Gradient vector.
@@ -236,6 +588,54 @@ public:
     updateBounds(const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound,
                  const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound);
 
+    /**
+     * Update the linear part of the cost function (Gradient) with a vector whose scalar type is
+     * not c_float. The vector is converted in a buffer reserved by initSolver(), hence no memory
+     * is allocated as long as its size does not change.
+     * @param gradient is the Gradient vector.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    updateGradient(const Eigen::MatrixBase<Derived>& gradient);
+
+    /**
+     * Update the lower bounds limit (size m) with a vector whose scalar type is not c_float.
+     * @param lowerBound is the lower bound constraint vector.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    updateLowerBound(const Eigen::MatrixBase<Derived>& lowerBound);
+
+    /**
+     * Update the upper bounds limit (size m) with a vector whose scalar type is not c_float.
+     * @param upperBound is the upper bound constraint vector.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    updateUpperBound(const Eigen::MatrixBase<Derived>& upperBound);
+
+    /**
+     * Update both upper and lower bounds (size m) with vectors whose scalar type is not c_float.
+     * @param lowerBound is the lower bound constraint vector;
+     * @param upperBound is the upper bound constraint vector.
+     * @return true/false in case of success/failure.
+     */
+    template <typename Derived>
+    typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+    updateBounds(const Eigen::MatrixBase<Derived>& lowerBound,
+                 const Eigen::MatrixBase<Derived>& upperBound);
+
+    /**
+     * Update the gradient and the bounds with the vectors currently stored in the Data object.
+     * It can be used together with Data::setVectorsCopy() and Data::swapVectorsBuffers() to
+     * prepare the vectors of the next problem while the current one is solved.
+     * @return true/false in case of success/failure.
+     */
+    bool updateVectorsFromData();
+
     /**
      * Update the quadratic part of the cost function (Hessian).
      * It is assumed to be a symmetric matrix.
@@ -243,6 +643,10 @@ public:
      * If the sparsity pattern is preserved the matrix is simply update
      * otherwise the entire solver will be reinitialized. In this case
      * the primal and dual variable are copied in the new workspace.
+     * \note
+     * The sparsity pattern of the hessian is cached in initSolver(). If the hessian is a column
+     * major matrix its values are compared directly against the cached pattern and only the
+     * changed values are sent to OSQP, without evaluating any triplet.
      *
      * @param hessian is the Hessian matrix.
      * @return true/false in case of success/failure.
@@ -256,6 +660,10 @@ public:
      * If the sparsity pattern is preserved the matrix is simply update
      * otherwise the entire solver will be reinitialized. In this case
      * the primal and dual variable are copied in the new workspace.
+     * \note
+     * The sparsity pattern of the matrix is cached in initSolver(). If the matrix is column major
+     * its values are compared directly against the cached pattern and only the changed values
+     * are sent to OSQP, without evaluating any triplet.
      *
      * @param linearConstraintsMatrix is the linear constraint matrix A
      * @return true/false in case of success/failure.
@@ -264,6 +672,33 @@ public:
     bool updateLinearConstraintsMatrix(
         const Eigen::SparseCompressedBase<Derived>& linearConstraintsMatrix);
 
+    /**
+     * Update the values of the quadratic part of the cost function (Hessian) without checking
+     * its sparsity pattern.
+     * @param hessianValues vector containing all the non zero values of the upper triangular part
+     * of the hessian matrix stored in compressed-column order, i.e. the same order used by the
+     * OSQP matrix set in initSolver().
+     * @note The size of hessianValues has to be equal to the number of non zeros of the upper
+     * triangular part of the hessian matrix. The sparsity pattern can not be changed with this
+     * method.
+     * @return true/false in case of success/failure.
+     */
+    bool updateHessianValues(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& hessianValues);
+
+    /**
+     * Update the values of the linear constraints matrix (A) without checking its sparsity
+     * pattern.
+     * @param linearConstraintsValues vector containing all the non zero values of the linear
+     * constraints matrix stored in compressed-column order, i.e. the same order used by the OSQP
+     * matrix set in initSolver().
+     * @note The size of linearConstraintsValues has to be equal to the number of non zeros of the
+     * linear constraints matrix. The sparsity pattern can not be changed with this method.
+     * @return true/false in case of success/failure.
+     */
+    bool updateLinearConstraintsValues(
+        const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& linearConstraintsValues);
+
     /**
      * Set the entire
      * @param linearConstraintsMatrix is the linear constraint matrix A
@@ -273,6 +708,21 @@ public:
     bool setWarmStart(const Eigen::Matrix<T, n, 1>& primalVariable,
                       const Eigen::Matrix<T, m, 1>& dualVariable);
 
+    /**
+     * Warm start the solver with the last solution shifted by one stage, as done in receding
+     * horizon MPC. The primal and the dual vectors are split in consecutive blocks of stages, in
+     * each block the stage k takes the value of the stage k + 1 and the last stage is kept. The
+     * solution is shifted in place in the OSQP buffers, hence no memory is allocated.
+     * @param primalStageBlocks are the blocks of the primal vector. The sum of their sizes has to
+     * be equal to the number of variables.
+     * @param dualStageBlocks are the blocks of the dual vector. The sum of their sizes has to be
+     * equal to the number of constraints.
+     * @note the solution returned by the solver is overwritten.
+     * @return true/false in case of success/failure.
+     */
+    bool warmStartShifted(const std::vector<OsqpEigen::StageBlock>& primalStageBlocks,
+                          const std::vector<OsqpEigen::StageBlock>& dualStageBlocks);
+
     template <typename T, int n>
     bool setPrimalVariable(const Eigen::Matrix<T, n, 1>& primalVariable);
 
@@ -11,60 +11,109 @@
 #include <scaling.h>
 #endif
 
-#include "Debug.hpp"
+#include "Logging.hpp"
 
 template <typename Derived>
 bool OsqpEigen::Solver::updateHessianMatrix(
     const Eigen::SparseCompressedBase<Derived>& hessianMatrix)
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] The solver has not been "
-                         "initialized."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] The solver has not been "
+                             "initialized.");
         return false;
     }
 
     if (((c_int)hessianMatrix.rows() != getData()->n)
         || ((c_int)hessianMatrix.cols() != getData()->n))
     {
-        debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] The hessian matrix has to be a "
-                         "nxn matrix"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] The hessian matrix has to "
+                             "be a nxn matrix");
         return false;
     }
 
-    // evaluate the triplets from old and new hessian sparse matrices
-    if (!OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(getData()->P,
-                                                                   m_oldHessianTriplet))
+    // try to update the hessian matrix without reinitialize the solver
+    // according to the osqp library it can be done only if the sparsity pattern of the hessian
+    // matrix does not change.
+    bool isSparsityPatternPreserved;
+    if (!Derived::IsRowMajor)
     {
-        debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to evaluate triplets "
-                         "from the old hessian matrix."
-                      << std::endl;
-        return false;
-    }
-    if (!OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(hessianMatrix,
-                                                                    m_newHessianTriplet))
+        // the columns of the matrix can be directly compared with the cached sparsity pattern
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.patternComparison);
+        isSparsityPatternPreserved = evaluateNewValues(hessianMatrix,
+                                                       m_hessianOuterIndex,
+                                                       m_hessianInnerIndex,
+                                                       m_hessianValues,
+                                                       true,
+                                                       m_isSparsityPatternSuperset,
+                                                       m_hessianNewIndices,
+                                                       m_hessianNewValues);
+    } else if (m_isSparsityPatternSuperset)
     {
-        debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to evaluate triplets "
-                         "from the old hessian matrix."
-                      << std::endl;
-        return false;
-    }
+        // the elements of a row major matrix are not sorted by column, hence a column major copy
+        // is required to compare it with the maximal sparsity pattern
+        Eigen::SparseMatrix<typename Derived::value_type,
+                            Eigen::ColMajor,
+                            typename Derived::StorageIndex>
+            columnMajorHessianMatrix;
+        {
+            OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.tripletExtraction);
+            columnMajorHessianMatrix = hessianMatrix;
+        }
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.patternComparison);
+        isSparsityPatternPreserved = evaluateNewValues(columnMajorHessianMatrix,
+                                                       m_hessianOuterIndex,
+                                                       m_hessianInnerIndex,
+                                                       m_hessianValues,
+                                                       true,
+                                                       true,
+                                                       m_hessianNewIndices,
+                                                       m_hessianNewValues);
+    } else
+    {
+        // evaluate the triplets from old and new hessian sparse matrices
+        {
+            OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.tripletExtraction);
+            // the values stored in Data are the ones set in initSolver(), while the cached ones
+            // are aligned with the solver
+            if (!cachedMatrixToTriplets(getData()->n,
+                                        m_hessianOuterIndex,
+                                        m_hessianInnerIndex,
+                                        m_hessianValues,
+                                        m_oldHessianTriplet))
+            {
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to evaluate "
+                                     "triplets from the old hessian matrix.");
+                return false;
+            }
+            if (!OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(hessianMatrix,
+                                                                            m_newHessianTriplet))
+            {
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to evaluate "
+                                     "triplets from the new hessian matrix.");
+                return false;
+            }
 
-    selectUpperTriangularTriplets(m_newHessianTriplet, m_newUpperTriangularHessianTriplets);
+            selectUpperTriangularTriplets(m_newHessianTriplet,
+                                          m_newUpperTriangularHessianTriplets);
+        }
 
-    // try to update the hessian matrix without reinitialize the solver
-    // according to the osqp library it can be done only if the sparsity pattern of the hessian
-    // matrix does not change.
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.patternComparison);
+        isSparsityPatternPreserved = evaluateNewValues(m_oldHessianTriplet,
+                                                       m_newUpperTriangularHessianTriplets,
+                                                       m_hessianNewIndices,
+                                                       m_hessianNewValues);
+    }
 
-    if (evaluateNewValues(m_oldHessianTriplet,
-                          m_newUpperTriangularHessianTriplets,
-                          m_hessianNewIndices,
-                          m_hessianNewValues))
+    if (isSparsityPatternPreserved)
     {
+        OSQP_EIGEN_STATS_UPDATE(m_stats.lastChangedValues = m_hessianNewValues.size());
+        OSQP_EIGEN_STATS_UPDATE(m_stats.totalChangedValues += m_hessianNewValues.size());
         if (m_hessianNewValues.size() > 0)
         {
+            OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.matrixUpdate);
 #ifdef OSQP_EIGEN_OSQP_IS_V1
             if (osqp_update_data_mat(m_solver.get(),
                                      m_hessianNewValues.data(),
@@ -83,32 +132,39 @@ bool OsqpEigen::Solver::updateHessianMatrix(
                 != 0)
             {
 #endif
-                debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to update "
-                                 "hessian matrix."
-                              << std::endl;
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to update "
+                                     "hessian matrix.");
                 return false;
             }
+
+            // keep the cached values aligned with the ones stored in the solver
+            for (size_t i = 0; i < m_hessianNewIndices.size(); i++)
+            {
+                m_hessianValues[m_hessianNewIndices[i]] = m_hessianNewValues[i];
+            }
         }
     } else
     {
         // the sparsity pattern has changed
         // the solver has to be setup again
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.reinitialization);
+        OsqpEigen::SolverEventScope event(m_eventRingBuffer.get(),
+                                          OsqpEigen::SolverEventType::HessianReinitialization,
+                                          this);
 
         // get the primal and the dual variables
 
         if (!getPrimalVariable(m_primalVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to get the primal "
-                             "variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to get the "
+                                 "primal variable.");
             return false;
         }
 
         if (!getDualVariable(m_dualVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to get the dual "
-                             "variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to get the dual "
+                                 "variable.");
             return false;
         }
 
@@ -118,9 +174,8 @@ bool OsqpEigen::Solver::updateHessianMatrix(
         // set new hessian matrix
         if (!m_data->setHessianMatrix(hessianMatrix))
         {
-            debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to update the "
-                             "hessian matrix in "
-                          << "OptimizaroData object." << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to update the "
+                                 "hessian matrix in OptimizaroData object.");
             return false;
         }
 
@@ -130,28 +185,27 @@ bool OsqpEigen::Solver::updateHessianMatrix(
         // initialize a new solver
         if (!initSolver())
         {
-            debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to Initialize the "
-                             "solver."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to Initialize "
+                                 "the solver.");
             return false;
         }
 
         // set the old primal and dual variables
         if (!setPrimalVariable(m_primalVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to set the primal "
-                             "variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to set the "
+                                 "primal variable.");
             return false;
         }
 
         if (!setDualVariable(m_dualVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateHessianMatrix] Unable to set the dual "
-                             "variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianMatrix] Unable to set the dual "
+                                 "variable.");
             return false;
         }
+
+        event.setExitFlag(0);
     }
     return true;
 }
@@ -160,53 +214,98 @@ template <typename Derived>
 bool OsqpEigen::Solver::updateLinearConstraintsMatrix(
     const Eigen::SparseCompressedBase<Derived>& linearConstraintsMatrix)
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] The solver has not "
-                         "been initialized."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] The solver has "
+                             "not been initialized.");
         return false;
     }
 
     if (((c_int)linearConstraintsMatrix.rows() != getData()->m)
         || ((c_int)linearConstraintsMatrix.cols() != getData()->n))
     {
-        debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] The constraints "
-                         "matrix has to be a mxn matrix"
-                      << std::endl;
-        return false;
-    }
-
-    // evaluate the triplets from old and new hessian sparse matrices
-
-    if (!OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(getData()->A,
-                                                                   m_oldLinearConstraintsTriplet))
-    {
-        debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to evaluate "
-                         "triplets from the old hessian matrix."
-                      << std::endl;
-        return false;
-    }
-    if (!OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(linearConstraintsMatrix,
-                                                                    m_newLinearConstraintsTriplet))
-    {
-        debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to evaluate "
-                         "triplets from the old hessian matrix."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] The constraints "
+                             "matrix has to be a mxn matrix");
         return false;
     }
 
     // try to update the linear constraints matrix without reinitialize the solver
     // according to the osqp library it can be done only if the sparsity pattern of the
     // matrix does not change.
+    bool isSparsityPatternPreserved;
+    if (!Derived::IsRowMajor)
+    {
+        // the columns of the matrix can be directly compared with the cached sparsity pattern
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.patternComparison);
+        isSparsityPatternPreserved = evaluateNewValues(linearConstraintsMatrix,
+                                                       m_constraintsOuterIndex,
+                                                       m_constraintsInnerIndex,
+                                                       m_constraintsValues,
+                                                       false,
+                                                       m_isSparsityPatternSuperset,
+                                                       m_constraintsNewIndices,
+                                                       m_constraintsNewValues);
+    } else if (m_isSparsityPatternSuperset)
+    {
+        // the elements of a row major matrix are not sorted by column, hence a column major copy
+        // is required to compare it with the maximal sparsity pattern
+        Eigen::SparseMatrix<typename Derived::value_type,
+                            Eigen::ColMajor,
+                            typename Derived::StorageIndex>
+            columnMajorLinearConstraintsMatrix;
+        {
+            OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.tripletExtraction);
+            columnMajorLinearConstraintsMatrix = linearConstraintsMatrix;
+        }
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.patternComparison);
+        isSparsityPatternPreserved = evaluateNewValues(columnMajorLinearConstraintsMatrix,
+                                                       m_constraintsOuterIndex,
+                                                       m_constraintsInnerIndex,
+                                                       m_constraintsValues,
+                                                       false,
+                                                       true,
+                                                       m_constraintsNewIndices,
+                                                       m_constraintsNewValues);
+    } else
+    {
+        // evaluate the triplets from old and new linear constraints sparse matrices
+        {
+            OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.tripletExtraction);
+            if (!cachedMatrixToTriplets(getData()->m,
+                                        m_constraintsOuterIndex,
+                                        m_constraintsInnerIndex,
+                                        m_constraintsValues,
+                                        m_oldLinearConstraintsTriplet))
+            {
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to "
+                                     "evaluate triplets from the old linear constraints matrix.");
+                return false;
+            }
+            if (!OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(
+                    linearConstraintsMatrix, m_newLinearConstraintsTriplet))
+            {
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to "
+                                     "evaluate triplets from the new linear constraints matrix.");
+                return false;
+            }
+        }
+
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.patternComparison);
+        isSparsityPatternPreserved = evaluateNewValues(m_oldLinearConstraintsTriplet,
+                                                       m_newLinearConstraintsTriplet,
+                                                       m_constraintsNewIndices,
+                                                       m_constraintsNewValues);
+    }
 
-    if (evaluateNewValues(m_oldLinearConstraintsTriplet,
-                          m_newLinearConstraintsTriplet,
-                          m_constraintsNewIndices,
-                          m_constraintsNewValues))
+    if (isSparsityPatternPreserved)
     {
+        OSQP_EIGEN_STATS_UPDATE(m_stats.lastChangedValues = m_constraintsNewValues.size());
+        OSQP_EIGEN_STATS_UPDATE(m_stats.totalChangedValues += m_constraintsNewValues.size());
         if (m_constraintsNewValues.size() > 0)
         {
+            OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.matrixUpdate);
 #ifdef OSQP_EIGEN_OSQP_IS_V1
             if (osqp_update_data_mat(m_solver.get(),
                                      nullptr,
@@ -225,32 +324,40 @@ bool OsqpEigen::Solver::updateLinearConstraintsMatrix(
                 != 0)
             {
 #endif
-                debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to "
-                                 "update linear constraints matrix."
-                              << std::endl;
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to "
+                                     "update linear constraints matrix.");
                 return false;
             }
+
+            // keep the cached values aligned with the ones stored in the solver
+            for (size_t i = 0; i < m_constraintsNewIndices.size(); i++)
+            {
+                m_constraintsValues[m_constraintsNewIndices[i]] = m_constraintsNewValues[i];
+            }
         }
     } else
     {
         // the sparsity pattern has changed
         // the solver has to be setup again
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.reinitialization);
+        OsqpEigen::SolverEventScope event(
+            m_eventRingBuffer.get(),
+            OsqpEigen::SolverEventType::LinearConstraintsReinitialization,
+            this);
 
         // get the primal and the dual variables
 
         if (!getPrimalVariable(m_primalVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to get the "
-                             "primal variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to get "
+                                 "the primal variable.");
             return false;
         }
 
         if (!getDualVariable(m_dualVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to get the "
-                             "dual variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to get "
+                                 "the dual variable.");
             return false;
         }
 
@@ -260,9 +367,8 @@ bool OsqpEigen::Solver::updateLinearConstraintsMatrix(
         // set new linear constraints matrix
         if (!m_data->setLinearConstraintsMatrix(linearConstraintsMatrix))
         {
-            debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to update "
-                             "the hessian matrix in "
-                          << "Data object." << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to "
+                                 "update the hessian matrix in Data object.");
             return false;
         }
 
@@ -271,56 +377,134 @@ bool OsqpEigen::Solver::updateLinearConstraintsMatrix(
 
         if (!initSolver())
         {
-            debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to "
-                             "Initialize the solver."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to "
+                                 "Initialize the solver.");
             return false;
         }
 
         // set the old primal and dual variables
         if (!setPrimalVariable(m_primalVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to set the "
-                             "primal variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to set "
+                                 "the primal variable.");
             return false;
         }
 
         if (!setDualVariable(m_dualVariables))
         {
-            debugStream() << "[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to set the "
-                             "dual variable."
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsMatrix] Unable to set "
+                                 "the dual variable.");
             return false;
         }
+
+        event.setExitFlag(0);
     }
     return true;
 }
 
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Solver::copySolutionTo(Eigen::MatrixBase<Derived>& solution) const
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copySolutionTo] The solver is not initialized");
+        return false;
+    }
+
+    if (solution.rows() != getData()->n)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copySolutionTo] The size of the vector must be "
+                             "equal to the number of the variables.");
+        return false;
+    }
+
+    solution = solutionView().template cast<typename Derived::Scalar>();
+    return true;
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Solver::copyDualSolutionTo(Eigen::MatrixBase<Derived>& dualSolution) const
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copyDualSolutionTo] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    if (dualSolution.rows() != getData()->m)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copyDualSolutionTo] The size of the vector must "
+                             "be equal to the number of the constraints.");
+        return false;
+    }
+
+    dualSolution = dualSolutionView().template cast<typename Derived::Scalar>();
+    return true;
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Solver::updateGradient(const Eigen::MatrixBase<Derived>& gradient)
+{
+    // the conversion is done once here, then the c_float overload checks the vector
+    m_convertedGradient = gradient.template cast<c_float>();
+    return updateGradient(m_convertedGradient);
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Solver::updateLowerBound(const Eigen::MatrixBase<Derived>& lowerBound)
+{
+    m_convertedLowerBound = lowerBound.template cast<c_float>();
+    return updateLowerBound(m_convertedLowerBound);
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Solver::updateUpperBound(const Eigen::MatrixBase<Derived>& upperBound)
+{
+    m_convertedUpperBound = upperBound.template cast<c_float>();
+    return updateUpperBound(m_convertedUpperBound);
+}
+
+template <typename Derived>
+typename std::enable_if<!std::is_same<typename Derived::Scalar, c_float>::value, bool>::type
+OsqpEigen::Solver::updateBounds(const Eigen::MatrixBase<Derived>& lowerBound,
+                                const Eigen::MatrixBase<Derived>& upperBound)
+{
+    m_convertedLowerBound = lowerBound.template cast<c_float>();
+    m_convertedUpperBound = upperBound.template cast<c_float>();
+    return updateBounds(m_convertedLowerBound, m_convertedUpperBound);
+}
+
 template <typename T, int n, int m>
 bool OsqpEigen::Solver::setWarmStart(const Eigen::Matrix<T, n, 1>& primalVariable,
                                      const Eigen::Matrix<T, m, 1>& dualVariable)
 {
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::setWarmStart] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::setWarmStart] The solver is not initialized");
         return false;
     }
 
     if (primalVariable.rows() != getData()->n)
     {
-        debugStream() << "[OsqpEigen::Solver::setWarmStart] The size of the primal variable vector "
-                         "has to be equal to "
-                      << " the number of variables." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::setWarmStart] The size of the primal variable "
+                             "vector has to be equal to  the number of variables.");
         return false;
     }
 
     if (dualVariable.rows() != getData()->m)
     {
-        debugStream() << "[OsqpEigen::Solver::setWarmStart] The size of the dual variable vector "
-                         "has to be equal to "
-                      << " the number of constraints." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::setWarmStart] The size of the dual variable "
+                             "vector has to be equal to  the number of constraints.");
         return false;
     }
 
@@ -340,16 +524,15 @@ bool OsqpEigen::Solver::setPrimalVariable(const Eigen::Matrix<T, n, 1>& primalVa
 {
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::setPrimalVariable] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::setPrimalVariable] The solver is not "
+                             "initialized");
         return false;
     }
 
     if (primalVariable.rows() != getData()->n)
     {
-        debugStream() << "[OsqpEigen::Solver::setPrimalVariable] The size of the primal variable "
-                         "vector has to be equal to "
-                      << " the number of variables." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::setPrimalVariable] The size of the primal "
+                             "variable vector has to be equal to  the number of variables.");
         return false;
     }
 
@@ -367,9 +550,8 @@ bool OsqpEigen::Solver::setDualVariable(const Eigen::Matrix<T, m, 1>& dualVariab
 {
     if (dualVariable.rows() != getData()->m)
     {
-        debugStream() << "[OsqpEigen::Solver::setDualVariable] The size of the dual variable "
-                         "vector has to be equal to "
-                      << " the number of constraints." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::setDualVariable] The size of the dual variable "
+                             "vector has to be equal to  the number of constraints.");
         return false;
     }
 
@@ -387,8 +569,8 @@ bool OsqpEigen::Solver::getPrimalVariable(Eigen::Matrix<T, n, 1>& primalVariable
 {
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::getPrimalVariable] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::getPrimalVariable] The solver is not "
+                             "initialized");
         return false;
     }
 
@@ -399,10 +581,9 @@ bool OsqpEigen::Solver::getPrimalVariable(Eigen::Matrix<T, n, 1>& primalVariable
     {
         if (n != getData()->n)
         {
-            debugStream() << "[OsqpEigen::Solver::getPrimalVariable] The size of the vector has to "
-                             "be equal to the number of variables. (You can use an eigen dynamic "
-                             "vector)"
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::getPrimalVariable] The size of the vector "
+                                 "has to be equal to the number of variables. (You can use an "
+                                 "eigen dynamic vector)");
             return false;
         }
     }
@@ -423,8 +604,7 @@ bool OsqpEigen::Solver::getDualVariable(Eigen::Matrix<T, m, 1>& dualVariable)
 {
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::getDualVariable] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::getDualVariable] The solver is not initialized");
         return false;
     }
 
@@ -435,10 +615,9 @@ bool OsqpEigen::Solver::getDualVariable(Eigen::Matrix<T, m, 1>& dualVariable)
     {
         if (m != getData()->m)
         {
-            debugStream() << "[OsqpEigen::Solver::getDualVariable] The size of the vector has to "
-                             "be equal to the number of constraints. (You can use an eigen dynamic "
-                             "vector)"
-                          << std::endl;
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::getDualVariable] The size of the vector has "
+                                 "to be equal to the number of constraints. (You can use an eigen "
+                                 "dynamic vector)");
             return false;
         }
     }
@@ -497,6 +676,96 @@ bool OsqpEigen::Solver::evaluateNewValues(const std::vector<Eigen::Triplet<T>>&
     return false;
 }
 
+template <typename Derived>
+bool OsqpEigen::Solver::evaluateNewValues(const Eigen::SparseCompressedBase<Derived>& newMatrix,
+                                          const std::vector<c_int>& outerIndex,
+                                          const std::vector<c_int>& innerIndex,
+                                          const std::vector<c_float>& oldValues,
+                                          bool isUpperTriangular,
+                                          bool isSuperset,
+                                          std::vector<c_int>& newIndices,
+                                          std::vector<c_float>& newValues) const
+{
+    // The position of an element in the cached value vector is the same position required by
+    // osqp to update the matrix. The elements of each column of an eigen column major matrix are
+    // sorted by row, as the ones of an osqp matrix.
+    const c_int numberOfColumns = static_cast<c_int>(outerIndex.size()) - 1;
+
+    // if the new matrix has exactly the cached sparsity pattern, e.g. it is the matrix set in
+    // initSolver() with new values, the index arrays are compared as a whole and only the values
+    // are visited
+    if (!Derived::IsRowMajor && newMatrix.isCompressed()
+        && (newMatrix.outerSize() == numberOfColumns)
+        && (newMatrix.nonZeros() == static_cast<Eigen::Index>(oldValues.size()))
+        && OsqpEigen::SparseMatrixHelper::isSparsityPatternEqual(numberOfColumns,
+                                                                 outerIndex.data(),
+                                                                 innerIndex.data(),
+                                                                 newMatrix.outerIndexPtr(),
+                                                                 newMatrix.innerIndexPtr()))
+    {
+        OsqpEigen::SparseMatrixHelper::evaluateChangedValues(static_cast<c_int>(oldValues.size()),
+                                                             oldValues.data(),
+                                                             newMatrix.valuePtr(),
+                                                             newIndices,
+                                                             newValues);
+        return true;
+    }
+
+    newIndices.clear();
+    newValues.clear();
+
+    const auto addNewValue = [&](const c_int position, const c_float value) {
+        if (value != oldValues[position])
+        {
+            newIndices.push_back(position);
+            newValues.push_back(value);
+        }
+    };
+
+    for (c_int k = 0; k < numberOfColumns; k++)
+    {
+        c_int position = outerIndex[k];
+        for (typename Eigen::SparseCompressedBase<Derived>::InnerIterator it(newMatrix, k); it;
+             ++it)
+        {
+            const c_int row = static_cast<c_int>(it.row());
+
+            // only the upper triangular part of the matrix is stored
+            if (isUpperTriangular && (row > k))
+                break;
+
+            // the cached elements missing in the new matrix are set to zero
+            while (isSuperset && (position < outerIndex[k + 1]) && (innerIndex[position] < row))
+            {
+                addNewValue(position, 0);
+                position++;
+            }
+
+            // check if the sparsity pattern is changed
+            if ((position >= outerIndex[k + 1]) || (row != innerIndex[position]))
+                return false;
+
+            // check if an old value is changed
+            addNewValue(position, static_cast<c_float>(it.value()));
+            position++;
+        }
+
+        if (isSuperset)
+        {
+            for (; position < outerIndex[k + 1]; position++)
+            {
+                addNewValue(position, 0);
+            }
+        }
+
+        // some elements of the column are missing
+        if (position != outerIndex[k + 1])
+            return false;
+    }
+
+    return true;
+}
+
 template <typename T>
 void OsqpEigen::Solver::selectUpperTriangularTriplets(
     const std::vector<Eigen::Triplet<T>>& fullMatrixTriplets,
@@ -0,0 +1,163 @@
+/**
+ * @file SolverPool.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_SOLVER_POOL_HPP
+#define OSQPEIGEN_SOLVER_POOL_HPP
+
+// Std
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Eigen
+#include <Eigen/Sparse>
+
+// OsqpEigen
+#include <OsqpEigen/Compat.hpp>
+#include <OsqpEigen/Solver.hpp>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * SolverPool class stores initialized solvers, so that the OSQP workspaces can be reused by
+ * problems having the same size and the same sparsity patterns. A solver released to the pool can
+ * be acquired by any thread. The gradient, the bounds and the values of the matrices of an
+ * acquired solver are the ones of its last problem, hence they have to be set with the update
+ * methods of the solver. The settings are the ones used in initSolver().
+ * When a solver is released its Data object is detached from the caller, i.e. the matrices and the
+ * vectors are replaced by copies of the ones stored in the solver, hence the caller can destroy
+ * them.
+ * If no solver is available, the caller creates and initializes a new one, then releases it to
+ * the pool when it is not needed anymore.
+ */
+class SolverPool
+{
+public:
+    /**
+     * Key struct identifies the problems that can share a solver. The sparsity patterns are
+     * stored in compressed-column form, so that two problems whose patterns have the same hash
+     * never share a solver.
+     */
+    struct Key
+    {
+        c_int numberOfVariables{0}; /**< Number of variables. */
+        c_int numberOfConstraints{0}; /**< Number of constraints. */
+        std::vector<c_int> hessianOuterIndex; /**< Column pointers of the upper triangular part
+                                                 of the hessian matrix. */
+        std::vector<c_int> hessianInnerIndex; /**< Row indices of the upper triangular part of
+                                                 the hessian matrix. */
+        std::vector<c_int> linearConstraintsOuterIndex; /**< Column pointers of the linear
+                                                           constraints matrix. */
+        std::vector<c_int> linearConstraintsInnerIndex; /**< Row indices of the linear
+                                                           constraints matrix. */
+        std::size_t hessianPatternHash{0}; /**< Hash of the sparsity pattern of the upper
+                                              triangular part of the hessian matrix. */
+        std::size_t linearConstraintsPatternHash{0}; /**< Hash of the sparsity pattern of the
+                                                        linear constraints matrix. */
+
+        /**
+         * Compare two keys.
+         * @param other is the other key.
+         * @return true if the sizes and the sparsity patterns are equal.
+         */
+        bool operator==(const Key& other) const;
+    };
+
+    /**
+     * KeyHash struct is the hash function of the keys.
+     */
+    struct KeyHash
+    {
+        /**
+         * Get the hash of a key.
+         * @param key is the key.
+         * @return the hash of the key.
+         */
+        std::size_t operator()(const Key& key) const;
+    };
+
+private:
+    std::mutex m_mutex; /**< Mutex protecting the stored solvers. */
+    std::unordered_map<Key, std::vector<std::unique_ptr<OsqpEigen::Solver>>, KeyHash>
+        m_solvers; /**< Solvers available for each key. */
+    std::size_t m_maximumNumberOfSolversPerKey; /**< Maximum number of solvers stored for each
+                                                   key. */
+
+public:
+    /**
+     * Constructor.
+     * @param maximumNumberOfSolversPerKey is the maximum number of solvers stored for each key.
+     * The solvers released when the limit is reached are deallocated.
+     */
+    SolverPool(
+        std::size_t maximumNumberOfSolversPerKey = std::numeric_limits<std::size_t>::max());
+
+    SolverPool(const SolverPool&) = delete;
+    SolverPool& operator=(const SolverPool&) = delete;
+
+    /**
+     * Compute the key of a problem. Only the upper triangular part of the hessian matrix is
+     * considered.
+     * @param hessianMatrix is the hessian matrix;
+     * @param linearConstraintsMatrix is the linear constraints matrix.
+     * @return the key of the problem.
+     */
+    static Key computeKey(const Eigen::SparseMatrix<c_float>& hessianMatrix,
+                          const Eigen::SparseMatrix<c_float>& linearConstraintsMatrix);
+
+    /**
+     * Compute the key of the problem of an initialized solver. The sparsity patterns are the ones
+     * cached by the solver, hence the matrices set in Data are not read.
+     * @param solver is the solver.
+     * @return the key of the problem. It is a default key if the solver is not initialized.
+     */
+    static Key computeKey(OsqpEigen::Solver& solver);
+
+    /**
+     * Acquire a solver.
+     * @param key is the key of the problem.
+     * @return an initialized solver if a solver having the same key has been released to the
+     * pool, a null pointer otherwise.
+     */
+    std::unique_ptr<OsqpEigen::Solver> acquire(const Key& key);
+
+    /**
+     * Release a solver to the pool. The solver variables are set to zero, so that the next
+     * problem is not warm started with the solution of the previous one, and the Data object is
+     * detached from the caller with Solver::detachData().
+     * @param solver is the solver. It has to be initialized and its asynchronous solves have to
+     * be completed.
+     * @return true if the solver is stored, false if it is deallocated.
+     */
+    bool release(std::unique_ptr<OsqpEigen::Solver> solver);
+
+    /**
+     * Get the number of solvers stored in the pool.
+     * @return the number of solvers available for all the keys.
+     */
+    std::size_t getNumberOfSolvers();
+
+    /**
+     * Get the number of solvers stored in the pool for a key.
+     * @param key is the key of the problem.
+     * @return the number of solvers available for the key.
+     */
+    std::size_t getNumberOfSolvers(const Key& key);
+
+    /**
+     * Deallocate all the stored solvers.
+     */
+    void clear();
+};
+} // namespace OsqpEigen
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file SolverStats.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_SOLVER_STATS_HPP
+#define OSQPEIGEN_SOLVER_STATS_HPP
+
+// Std
+#include <chrono>
+#include <cstddef>
+
+// OsqpEigen
+#include <OsqpEigen/Compat.hpp>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * PhaseStats contains the timing of a phase of the solver. The durations are expressed in seconds
+ * and are measured with a monotonic clock.
+ */
+struct PhaseStats
+{
+    std::size_t calls{0}; /**< Number of times the phase has been executed. */
+    double lastDuration{0}; /**< Duration of the last execution of the phase. */
+    double totalDuration{0}; /**< Sum of the durations of all the executions of the phase. */
+
+    /**
+     * Add an execution of the phase.
+     * @param duration is the duration of the execution.
+     */
+    void add(double duration) noexcept
+    {
+        calls++;
+        lastDuration = duration;
+        totalDuration += duration;
+    }
+};
+
+/**
+ * SolverStats contains the timing and the counters of a Solver. It separates the time spent by
+ * the wrapper from the one reported by OSQP.
+ * The statistics are collected only if the library is compiled with the OSQP_EIGEN_SOLVER_STATS
+ * CMake option, otherwise all the fields are equal to zero.
+ */
+struct SolverStats
+{
+    PhaseStats initialization; /**< Calls of initSolver(). */
+    PhaseStats tripletExtraction; /**< Evaluation of the triplets (or of the column major copy)
+                                     of the matrices passed to the update methods. */
+    PhaseStats patternComparison; /**< Comparison of the sparsity patterns and evaluation of the
+                                     changed values. */
+    PhaseStats matrixUpdate; /**< Update of the matrix values stored in OSQP. */
+    PhaseStats vectorUpdate; /**< Update of the gradient and of the bounds stored in OSQP. */
+    PhaseStats reinitialization; /**< Reinitialization of the solver due to a change of the
+                                    sparsity pattern. The number of calls is the number of
+                                    fallbacks taken. */
+    PhaseStats solve; /**< Calls of OSQP solve. */
+
+    std::size_t lastChangedValues{0}; /**< Number of values sent to OSQP by the last matrix
+                                         update. */
+    std::size_t totalChangedValues{0}; /**< Number of values sent to OSQP by all the matrix
+                                          updates. */
+
+    c_int iterations{0}; /**< Number of iterations of the last solve reported by OSQP. */
+    c_int rhoUpdates{0}; /**< Number of rho updates of the last solve reported by OSQP. */
+    std::size_t totalIterations{0}; /**< Number of iterations of all the solves. */
+
+    c_float osqpSetupTime{0}; /**< Setup time reported by OSQP. */
+    c_float osqpSolveTime{0}; /**< Solve time of the last solve reported by OSQP. */
+    c_float osqpUpdateTime{0}; /**< Update time reported by OSQP. */
+    c_float osqpPolishTime{0}; /**< Polish time of the last solve reported by OSQP. */
+    c_float osqpRunTime{0}; /**< Total time of the last solve reported by OSQP. */
+
+    /**
+     * Check if the library has been compiled with the statistics.
+     * @return true if the OSQP_EIGEN_SOLVER_STATS option is enabled.
+     */
+    static constexpr bool isEnabled() noexcept
+    {
+#ifdef OSQP_EIGEN_SOLVER_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+};
+
+/**
+ * ScopedPhaseTimer class adds the lifetime of the object to a PhaseStats.
+ */
+class ScopedPhaseTimer
+{
+    PhaseStats& m_phase; /**< Phase updated when the object is destroyed. */
+    std::chrono::steady_clock::time_point m_start; /**< Time when the object was created. */
+
+public:
+    /**
+     * Constructor. It starts the timer.
+     * @param phase is the phase updated when the object is destroyed.
+     */
+    explicit ScopedPhaseTimer(PhaseStats& phase) noexcept
+        : m_phase(phase)
+        , m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    /**
+     * Deconstructor. It stops the timer.
+     */
+    ~ScopedPhaseTimer()
+    {
+        m_phase.add(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count());
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+};
+} // namespace OsqpEigen
+
+#ifdef OSQP_EIGEN_SOLVER_STATS
+#define OSQP_EIGEN_STATS_PHASE_SCOPE(phase)                                                        \
+    const OsqpEigen::ScopedPhaseTimer osqpEigenPhaseTimer(phase)
+#define OSQP_EIGEN_STATS_UPDATE(statement) statement
+#else
+#define OSQP_EIGEN_STATS_PHASE_SCOPE(phase)
+#define OSQP_EIGEN_STATS_UPDATE(statement)
+#endif
+
+#endif
@@ -9,7 +9,10 @@
 #define SPARSE_MATRIX_HPP
 
 // std
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <vector>
 
 // eigen
 #include <Eigen/Sparse>
@@ -30,6 +33,47 @@ namespace OsqpEigen
 namespace SparseMatrixHelper
 {
 
+/**
+ * Minimum number of non zero elements of a matrix processed in parallel. The smaller matrices are
+ * always processed by the calling thread.
+ */
+constexpr c_int parallelMinimumNonZeros = 1 << 16;
+
+/**
+ * Maximum number of threads used to process a matrix, the calling thread included.
+ */
+constexpr std::size_t maximumNumberOfParallelThreads = 64;
+
+/**
+ * Set the number of threads used to build, convert and compare the large matrices. The calling
+ * thread is counted, hence 1 disables the parallel path. By default all the hardware threads are
+ * used. The threads are shared by all the matrices: if a thread processes a matrix while the
+ * threads are used by another one, it processes the matrix alone instead of waiting.
+ * @param numberOfThreads is the number of threads. It is limited to
+ * maximumNumberOfParallelThreads.
+ * @note it has effect only if the library is compiled with the
+ * OSQP_EIGEN_PARALLEL_MATRIX_CONSTRUCTION CMake option. The matrices processed while it is called
+ * keep using the previous threads.
+ */
+void setNumberOfThreads(std::size_t numberOfThreads);
+
+/**
+ * Get the number of threads used to build, convert and compare the large matrices.
+ * @return the number of threads, 1 if the parallel path is disabled.
+ */
+std::size_t getNumberOfThreads();
+
+namespace detail
+{
+/**
+ * Run task(i) for each i in [0, numberOfTasks) on the threads used to process the matrices and
+ * wait until all the tasks are completed.
+ * @param numberOfTasks is the number of tasks. It has to be at most getNumberOfThreads();
+ * @param task is the function called with the index of the task.
+ */
+void parallelFor(std::size_t numberOfTasks, const std::function<void(std::size_t)>& task);
+} // namespace detail
+
 /**
  * Allocate an osqpSparseMatrix struct.
  * NOTE: <code>c_malloc</code> function is used to allocate memory please call
@@ -40,6 +84,20 @@ template <typename Derived>
 bool createOsqpSparseMatrix(const Eigen::SparseCompressedBase<Derived>& eigenSparseMatrix,
                             csc*& osqpSparseMatrix);
 
+/**
+ * Allocate an osqpSparseMatrix struct containing only the upper triangular part of a square
+ * matrix. The elements below the diagonal are skipped while the matrix is copied, hence no
+ * intermediate matrix is built.
+ * NOTE: <code>c_malloc</code> function is used to allocate memory please call
+ * <code>c_free</code> to deallcate memory.
+ * @param eigenSparseMatrix is the square eigen sparse matrix.
+ * @param osqpSparseMatrix is the pointer to the csc struct. It has to be a null pointer.
+ * @return true/false in case of success/failure.
+ */
+template <typename Derived>
+bool createOsqpUpperTriangularSparseMatrix(
+    const Eigen::SparseCompressedBase<Derived>& eigenSparseMatrix, csc*& osqpSparseMatrix);
+
 /**
  * Convert an osqp sparse matrix into an eigen sparse matrix.
  * @param osqpSparseMatrix is  a constant pointer to a constant csc struct;
@@ -69,6 +127,44 @@ bool osqpSparseMatrixToTriplets(const csc* const& osqpSparseMatrix,
 template <typename Derived, typename T>
 bool eigenSparseMatrixToTriplets(const Eigen::SparseCompressedBase<Derived>& eigenSparseMatrix,
                                  std::vector<Eigen::Triplet<T>>& tripletList);
+
+/**
+ * Check if two compressed-column sparsity patterns are equal. If the index types are the same the
+ * arrays are compared with memcmp.
+ * @param numberOfColumns is the number of columns of both the matrices;
+ * @param outerIndex is the array of the column pointers of the first matrix (size
+ * numberOfColumns + 1);
+ * @param innerIndex is the array of the row indices of the first matrix;
+ * @param otherOuterIndex is the array of the column pointers of the second matrix;
+ * @param otherInnerIndex is the array of the row indices of the second matrix.
+ * @return true if the patterns are equal.
+ */
+template <typename IndexA, typename IndexB>
+bool isSparsityPatternEqual(c_int numberOfColumns,
+                            const IndexA* outerIndex,
+                            const IndexA* innerIndex,
+                            const IndexB* otherOuterIndex,
+                            const IndexB* otherInnerIndex);
+
+/**
+ * Find the values that differ between two arrays of non zero values sharing the same sparsity
+ * pattern. The values are compared in fixed size blocks and a bit mask of the changed elements
+ * is evaluated for each block, so that the comparison can be vectorized by the compiler and the
+ * blocks without changes are skipped. The changed values are stored without branches.
+ * @param numberOfNonZeros is the size of the arrays;
+ * @param oldValues is the array of the old values;
+ * @param newValues is the array of the new values;
+ * @param changedIndices vector where the positions of the changed values are stored. Its
+ * content is overwritten;
+ * @param changedValues vector where the changed values are stored. Its content is overwritten.
+ * @note no memory is allocated if the capacity of the vectors is at least numberOfNonZeros.
+ */
+template <typename T>
+void evaluateChangedValues(c_int numberOfNonZeros,
+                           const c_float* oldValues,
+                           const T* newValues,
+                           std::vector<c_int>& changedIndices,
+                           std::vector<c_float>& changedValues);
 }; // namespace SparseMatrixHelper
 } // namespace OsqpEigen
 
@@ -5,71 +5,356 @@
  * @date 2018
  */
 
-#include <OsqpEigen/Debug.hpp>
+#include <OsqpEigen/Logging.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace OsqpEigen
+{
+namespace SparseMatrixHelper
+{
+namespace detail
+{
+/**
+ * Get the number of ranges used to process a given amount of work.
+ * @param workSize is the number of elements to be processed.
+ * @return 1 if the work is too small to be split, the number of threads otherwise.
+ */
+inline std::size_t numberOfParallelRanges(c_int workSize)
+{
+    if (workSize < parallelMinimumNonZeros)
+    {
+        return 1;
+    }
+    return getNumberOfThreads();
+}
+
+/**
+ * Call function(r) for each range r in [0, numberOfRanges). A single range is processed directly
+ * by the calling thread.
+ */
+template <typename Function>
+void forEachRange(std::size_t numberOfRanges, const Function& function)
+{
+    if (numberOfRanges == 1)
+    {
+        function(0);
+        return;
+    }
+    parallelFor(numberOfRanges, std::function<void(std::size_t)>(std::cref(function)));
+}
+
+/**
+ * Get the first element of a range when size elements are split in numberOfRanges ranges of the
+ * same size.
+ */
+inline c_int rangeBegin(std::size_t range, std::size_t numberOfRanges, c_int size)
+{
+    return static_cast<c_int>(static_cast<std::int64_t>(size) * static_cast<std::int64_t>(range)
+                              / static_cast<std::int64_t>(numberOfRanges));
+}
+
+/**
+ * Get the first column of a range when the columns are split in numberOfRanges ranges with about
+ * the same number of non zero elements.
+ * @param outerIndex is the array of the column pointers. It has numberOfColumns + 1 elements.
+ */
+template <typename Index>
+c_int columnRangeBegin(std::size_t range,
+                       std::size_t numberOfRanges,
+                       c_int numberOfColumns,
+                       const Index* outerIndex)
+{
+    if (range == numberOfRanges)
+    {
+        return numberOfColumns;
+    }
+
+    // first column whose first element is at least the target
+    const Index target = static_cast<Index>(
+        outerIndex[0]
+        + rangeBegin(range,
+                     numberOfRanges,
+                     static_cast<c_int>(outerIndex[numberOfColumns] - outerIndex[0])));
+    return static_cast<c_int>(
+        std::lower_bound(outerIndex, outerIndex + numberOfColumns, target) - outerIndex);
+}
+} // namespace detail
+} // namespace SparseMatrixHelper
+} // namespace OsqpEigen
 
 template <typename Derived>
 bool OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(
     const Eigen::SparseCompressedBase<Derived>& eigenSparseMatrix, csc*& osqpSparseMatrix)
 
 {
-    // Copying into a new sparse matrix to be sure to use a CSC matrix
-    Eigen::SparseMatrix<typename Derived::value_type, Eigen::ColMajor> colMajorCopy;
-
-    // This may perform memory allocation, but this is already the case for allocating the
-    // osqpSparseMatrix
-    colMajorCopy = eigenSparseMatrix;
-
     // get number of row, columns and nonZeros from Eigen SparseMatrix
-    c_int rows = colMajorCopy.rows();
-    c_int cols = colMajorCopy.cols();
-    c_int numberOfNonZeroCoeff = colMajorCopy.nonZeros();
-
-    // get innerr and outer index
-    const int* outerIndexPtr = colMajorCopy.outerIndexPtr();
-    const int* innerNonZerosPtr = colMajorCopy.innerNonZeroPtr();
+    c_int rows = eigenSparseMatrix.rows();
+    c_int cols = eigenSparseMatrix.cols();
+    c_int numberOfNonZeroCoeff = eigenSparseMatrix.nonZeros();
 
     // instantiate csc matrix
     // MEMORY ALLOCATION!!
     if (osqpSparseMatrix != nullptr)
     {
-        debugStream() << "[OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix] osqpSparseMatrix "
-                         "pointer is not a null pointer! "
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix] "
+                             "osqpSparseMatrix pointer is not a null pointer! ");
         return false;
     }
 
     osqpSparseMatrix = OsqpEigen::spalloc(rows, cols, numberOfNonZeroCoeff);
 
-    int innerOsqpPosition = 0;
-    for (int k = 0; k < cols; k++)
+    if (!Derived::IsRowMajor && eigenSparseMatrix.isCompressed())
     {
-        if (colMajorCopy.isCompressed())
+        // the eigen storage is already in compressed-column form. The outer indices of a block of
+        // columns, e.g. middleCols(), point into the arrays of the whole matrix, hence they are
+        // shifted by the first one and the elements are copied starting from it
+        const auto* outerIndex = eigenSparseMatrix.outerIndexPtr();
+        const auto firstElement = outerIndex[0];
+        for (c_int k = 0; k <= cols; k++)
         {
-            osqpSparseMatrix->p[k] = static_cast<c_int>(outerIndexPtr[k]);
-        } else
+            osqpSparseMatrix->p[k] = static_cast<c_int>(outerIndex[k] - firstElement);
+        }
+
+        assert(osqpSparseMatrix->p[cols] == numberOfNonZeroCoeff);
+
+        // the large arrays are split in ranges of the same size copied in parallel. std::copy
+        // reduces to a memmove when the eigen and the osqp types are the same
+        const auto* innerIndex = eigenSparseMatrix.innerIndexPtr() + firstElement;
+        const auto* values = eigenSparseMatrix.valuePtr() + firstElement;
+        const std::size_t numberOfRanges = detail::numberOfParallelRanges(numberOfNonZeroCoeff);
+        detail::forEachRange(numberOfRanges, [&](std::size_t range) {
+            const c_int begin = detail::rangeBegin(range, numberOfRanges, numberOfNonZeroCoeff);
+            const c_int end = detail::rangeBegin(range + 1, numberOfRanges, numberOfNonZeroCoeff);
+            std::copy(innerIndex + begin, innerIndex + end, osqpSparseMatrix->i + begin);
+            std::copy(values + begin, values + end, osqpSparseMatrix->x + begin);
+        });
+        return true;
+    }
+
+    if (!Derived::IsRowMajor)
+    {
+        // uncompressed column-major matrix, the free space at the end of each column is skipped.
+        // The column pointers are evaluated first, then the columns are split in ranges with
+        // about the same number of non zero elements copied in parallel
+        osqpSparseMatrix->p[0] = 0;
+        for (c_int k = 0; k < cols; k++)
         {
-            if (k == 0)
-            {
-                osqpSparseMatrix->p[k] = 0;
-            } else
+            osqpSparseMatrix->p[k + 1]
+                = osqpSparseMatrix->p[k]
+                  + static_cast<c_int>(eigenSparseMatrix.innerNonZeroPtr()[k]);
+        }
+
+        assert(osqpSparseMatrix->p[cols] == numberOfNonZeroCoeff);
+
+        const std::size_t numberOfRanges = detail::numberOfParallelRanges(numberOfNonZeroCoeff);
+        detail::forEachRange(numberOfRanges, [&](std::size_t range) {
+            const c_int firstColumn
+                = detail::columnRangeBegin(range, numberOfRanges, cols, osqpSparseMatrix->p);
+            const c_int lastColumn
+                = detail::columnRangeBegin(range + 1, numberOfRanges, cols, osqpSparseMatrix->p);
+            for (c_int k = firstColumn; k < lastColumn; k++)
             {
-                osqpSparseMatrix->p[k] = osqpSparseMatrix->p[k - 1] + innerNonZerosPtr[k - 1];
+                c_int innerOsqpPosition = osqpSparseMatrix->p[k];
+                for (typename Eigen::SparseCompressedBase<Derived>::InnerIterator it(
+                         eigenSparseMatrix, k);
+                     it;
+                     ++it)
+                {
+                    osqpSparseMatrix->i[innerOsqpPosition] = static_cast<c_int>(it.row());
+                    osqpSparseMatrix->x[innerOsqpPosition] = static_cast<c_float>(it.value());
+                    innerOsqpPosition++;
+                }
             }
+        });
+
+        return true;
+    }
+
+    // row-major matrix, it is transposed while it is copied. The elements of a column are
+    // scattered among all the rows, hence this path is sequential. First the number of non zero
+    // elements of each column is stored in p[k + 1]
+    std::fill(osqpSparseMatrix->p, osqpSparseMatrix->p + cols + 1, 0);
+    for (c_int k = 0; k < rows; k++)
+    {
+        for (typename Eigen::SparseCompressedBase<Derived>::InnerIterator it(eigenSparseMatrix, k);
+             it;
+             ++it)
+        {
+            osqpSparseMatrix->p[it.col() + 1]++;
         }
-        for (typename Eigen::SparseMatrix<typename Derived::value_type,
-                                          Eigen::ColMajor>::InnerIterator it(colMajorCopy, k);
+    }
+
+    // then p[k] is turned into the position of the first element of the column k
+    for (c_int k = 0; k < cols; k++)
+    {
+        osqpSparseMatrix->p[k + 1] += osqpSparseMatrix->p[k];
+    }
+
+    // the rows are visited in increasing order, hence the row indices of each column are sorted.
+    // p[k] is used as insertion position of the column k and at the end it contains the
+    // position of the first element of the column k + 1
+    for (c_int k = 0; k < rows; k++)
+    {
+        for (typename Eigen::SparseCompressedBase<Derived>::InnerIterator it(eigenSparseMatrix, k);
              it;
              ++it)
         {
-            osqpSparseMatrix->i[innerOsqpPosition] = static_cast<c_int>(it.row());
-            osqpSparseMatrix->x[innerOsqpPosition] = static_cast<c_float>(it.value());
-            innerOsqpPosition++;
+            const c_int position = osqpSparseMatrix->p[it.col()]++;
+            osqpSparseMatrix->i[position] = static_cast<c_int>(it.row());
+            osqpSparseMatrix->x[position] = static_cast<c_float>(it.value());
+        }
+    }
+
+    for (c_int k = cols; k > 0; k--)
+    {
+        osqpSparseMatrix->p[k] = osqpSparseMatrix->p[k - 1];
+    }
+    osqpSparseMatrix->p[0] = 0;
+
+    assert(osqpSparseMatrix->p[cols] == numberOfNonZeroCoeff);
+
+    return true;
+}
+
+template <typename Derived>
+bool OsqpEigen::SparseMatrixHelper::createOsqpUpperTriangularSparseMatrix(
+    const Eigen::SparseCompressedBase<Derived>& eigenSparseMatrix, csc*& osqpSparseMatrix)
+{
+    if (osqpSparseMatrix != nullptr)
+    {
+        OSQP_EIGEN_LOG_ERROR(
+            "[OsqpEigen::SparseMatrixHelper::createOsqpUpperTriangularSparseMatrix] "
+            "osqpSparseMatrix pointer is not a null pointer! ");
+        return false;
+    }
+
+    if (eigenSparseMatrix.rows() != eigenSparseMatrix.cols())
+    {
+        OSQP_EIGEN_LOG_ERROR(
+            "[OsqpEigen::SparseMatrixHelper::createOsqpUpperTriangularSparseMatrix] "
+            "The matrix has to be square.");
+        return false;
+    }
+
+    const c_int size = static_cast<c_int>(eigenSparseMatrix.cols());
+    const auto* outerIndex = eigenSparseMatrix.outerIndexPtr();
+    const auto* innerIndex = eigenSparseMatrix.innerIndexPtr();
+    const auto* values = eigenSparseMatrix.valuePtr();
+
+    // the inner indices of each outer vector are sorted, hence the upper triangular elements of
+    // the column k are the first ones, up to row k, and the ones of the row k are the last ones,
+    // from column k. The indices are scanned linearly since the columns of a hessian matrix
+    // usually contain few elements
+    const auto* innerNonZeros = eigenSparseMatrix.innerNonZeroPtr();
+    const auto upperRange = [&](c_int k) {
+        const auto* begin = innerIndex + outerIndex[k];
+        const auto* end = innerNonZeros == nullptr ? innerIndex + outerIndex[k + 1]
+                                                   : begin + innerNonZeros[k];
+        if (Derived::IsRowMajor)
+        {
+            while ((begin != end) && (*begin < k))
+            {
+                ++begin;
+            }
+            return std::make_pair(begin, end);
+        }
+
+        const auto* upperEnd = begin;
+        while ((upperEnd != end) && (*upperEnd <= k))
+        {
+            ++upperEnd;
+        }
+        return std::make_pair(begin, upperEnd);
+    };
+
+    // the number of elements is required to allocate the matrix
+    c_int numberOfNonZeroCoeff = 0;
+    for (c_int k = 0; k < size; k++)
+    {
+        const auto range = upperRange(k);
+        numberOfNonZeroCoeff += static_cast<c_int>(range.second - range.first);
+    }
+
+    osqpSparseMatrix = OsqpEigen::spalloc(size, size, numberOfNonZeroCoeff);
+
+    if (!Derived::IsRowMajor)
+    {
+        // each column is copied up to the diagonal. The column pointers are evaluated first, then
+        // the columns are split in ranges with about the same number of non zero elements copied
+        // in parallel as done by createOsqpSparseMatrix()
+        osqpSparseMatrix->p[0] = 0;
+        for (c_int k = 0; k < size; k++)
+        {
+            const auto range = upperRange(k);
+            osqpSparseMatrix->p[k + 1]
+                = osqpSparseMatrix->p[k] + static_cast<c_int>(range.second - range.first);
+        }
+
+        assert(osqpSparseMatrix->p[size] == numberOfNonZeroCoeff);
+
+        const std::size_t numberOfRanges = detail::numberOfParallelRanges(numberOfNonZeroCoeff);
+        detail::forEachRange(numberOfRanges, [&](std::size_t range) {
+            const c_int firstColumn
+                = detail::columnRangeBegin(range, numberOfRanges, size, osqpSparseMatrix->p);
+            const c_int lastColumn
+                = detail::columnRangeBegin(range + 1, numberOfRanges, size, osqpSparseMatrix->p);
+            for (c_int k = firstColumn; k < lastColumn; k++)
+            {
+                c_int position = osqpSparseMatrix->p[k];
+                const auto upper = upperRange(k);
+                for (auto it = upper.first; it != upper.second; ++it)
+                {
+                    osqpSparseMatrix->i[position] = static_cast<c_int>(*it);
+                    osqpSparseMatrix->x[position] = static_cast<c_float>(values[it - innerIndex]);
+                    position++;
+                }
+            }
+        });
+
+        return true;
+    }
+
+    // row-major matrix, the elements of each row from the diagonal onward are transposed as done
+    // by createOsqpSparseMatrix(), hence this path is sequential
+    std::fill(osqpSparseMatrix->p, osqpSparseMatrix->p + size + 1, 0);
+    for (c_int k = 0; k < size; k++)
+    {
+        const auto range = upperRange(k);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            osqpSparseMatrix->p[*it + 1]++;
+        }
+    }
+
+    for (c_int k = 0; k < size; k++)
+    {
+        osqpSparseMatrix->p[k + 1] += osqpSparseMatrix->p[k];
+    }
+
+    for (c_int k = 0; k < size; k++)
+    {
+        const auto range = upperRange(k);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            const c_int position = osqpSparseMatrix->p[*it]++;
+            osqpSparseMatrix->i[position] = k;
+            osqpSparseMatrix->x[position] = static_cast<c_float>(values[it - innerIndex]);
         }
     }
-    osqpSparseMatrix->p[static_cast<int>(cols)] = static_cast<c_int>(innerOsqpPosition);
 
-    assert(innerOsqpPosition == numberOfNonZeroCoeff);
+    for (c_int k = size; k > 0; k--)
+    {
+        osqpSparseMatrix->p[k] = osqpSparseMatrix->p[k - 1];
+    }
+    osqpSparseMatrix->p[0] = 0;
+
+    assert(osqpSparseMatrix->p[size] == numberOfNonZeroCoeff);
 
     return true;
 }
@@ -81,9 +366,8 @@ bool OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(
     // if the matrix is not instantiate the triplets vector is empty
     if (osqpSparseMatrix == nullptr)
     {
-        debugStream() << "[OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets] the "
-                         "osqpSparseMatrix is not initialized."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets] the "
+                             "osqpSparseMatrix is not initialized.");
         return false;
     }
 
@@ -95,24 +379,27 @@ bool OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(
     c_float* valuePtr = osqpSparseMatrix->x;
     c_int numberOfNonZeroCoeff = osqpSparseMatrix->p[osqpSparseMatrix->n];
 
-    // populate the tripletes vector
-    int column = 0;
-    int row;
-    c_float value;
-
+    // populate the tripletes vector column by column, hence the column of an element is known
+    // without searching it in the column pointers. The columns are split in ranges with about the
+    // same number of non zero elements processed in parallel
     tripletList.resize(numberOfNonZeroCoeff);
-    for (int i = 0; i < numberOfNonZeroCoeff; i++)
-    {
-        row = innerIndexPtr[i];
-        value = valuePtr[i];
-
-        while (i >= outerIndexPtr[column + 1])
-            column++;
-
-        tripletList[i] = Eigen::Triplet<T>(row, column, static_cast<T>(value));
-    }
-
-    tripletList.erase(tripletList.begin() + numberOfNonZeroCoeff, tripletList.end());
+    const c_int numberOfColumns = osqpSparseMatrix->n;
+    const std::size_t numberOfRanges = detail::numberOfParallelRanges(numberOfNonZeroCoeff);
+    detail::forEachRange(numberOfRanges, [&](std::size_t range) {
+        const c_int firstColumn
+            = detail::columnRangeBegin(range, numberOfRanges, numberOfColumns, outerIndexPtr);
+        const c_int lastColumn
+            = detail::columnRangeBegin(range + 1, numberOfRanges, numberOfColumns, outerIndexPtr);
+        for (c_int column = firstColumn; column < lastColumn; column++)
+        {
+            for (c_int i = outerIndexPtr[column]; i < outerIndexPtr[column + 1]; i++)
+            {
+                tripletList[i] = Eigen::Triplet<T>(static_cast<int>(innerIndexPtr[i]),
+                                                   static_cast<int>(column),
+                                                   static_cast<T>(valuePtr[i]));
+            }
+        }
+    });
 
     return true;
 }
@@ -124,9 +411,8 @@ bool OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToEigenSparseMatrix(
     // if the matrix is not instantiate the eigen matrix is empty
     if (osqpSparseMatrix == nullptr)
     {
-        debugStream() << "[OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToEigenSparseMatrix] the "
-                         "osqpSparseMatrix is not initialized."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToEigenSparseMatrix] "
+                             "the osqpSparseMatrix is not initialized.");
         return false;
     }
 
@@ -154,13 +440,46 @@ bool OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(
 {
     if (eigenSparseMatrix.nonZeros() == 0)
     {
-        debugStream() << "[OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets] The "
-                         "eigenSparseMatrix is empty."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets] The "
+                             "eigenSparseMatrix is empty.");
         return false;
     }
 
     tripletList.resize(eigenSparseMatrix.nonZeros());
+
+    if (eigenSparseMatrix.isCompressed())
+    {
+        // the position of each element is known from the outer indices, hence the outer vectors
+        // are split in ranges with about the same number of non zero elements processed in
+        // parallel. The outer indices of a block, e.g. middleCols(), point into the arrays of the
+        // whole matrix, hence the positions are relative to the first one
+        const c_int outerSize = static_cast<c_int>(eigenSparseMatrix.outerSize());
+        const auto* outerIndexPtr = eigenSparseMatrix.outerIndexPtr();
+        const std::size_t numberOfRanges
+            = detail::numberOfParallelRanges(static_cast<c_int>(eigenSparseMatrix.nonZeros()));
+        detail::forEachRange(numberOfRanges, [&](std::size_t range) {
+            const c_int firstOuter
+                = detail::columnRangeBegin(range, numberOfRanges, outerSize, outerIndexPtr);
+            const c_int lastOuter
+                = detail::columnRangeBegin(range + 1, numberOfRanges, outerSize, outerIndexPtr);
+            for (c_int k = firstOuter; k < lastOuter; k++)
+            {
+                auto nonZero = outerIndexPtr[k] - outerIndexPtr[0];
+                for (typename Eigen::SparseCompressedBase<Derived>::InnerIterator it(
+                         eigenSparseMatrix, k);
+                     it;
+                     ++it)
+                {
+                    tripletList[nonZero]
+                        = Eigen::Triplet<T>(it.row(), it.col(), static_cast<T>(it.value()));
+                    nonZero++;
+                }
+            }
+        });
+
+        return true;
+    }
+
     // populate the triplet list
     int nonZero = 0;
     for (int k = 0; k < eigenSparseMatrix.outerSize(); ++k)
@@ -178,3 +497,177 @@ bool OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(
 
     return true;
 }
+
+namespace OsqpEigen
+{
+namespace SparseMatrixHelper
+{
+namespace detail
+{
+template <typename IndexA, typename IndexB>
+bool areIndicesEqual(const IndexA* indices, const IndexB* otherIndices, std::size_t size)
+{
+    return std::equal(indices, indices + size, otherIndices);
+}
+
+template <typename Index>
+bool areIndicesEqual(const Index* indices, const Index* otherIndices, std::size_t size)
+{
+    return (size == 0) || (std::memcmp(indices, otherIndices, size * sizeof(Index)) == 0);
+}
+
+/**
+ * Store the positions and the values of the elements in [begin, end) that are changed. They are
+ * written starting from the position begin of the output arrays.
+ * @return the number of changed elements.
+ */
+template <typename T>
+c_int compactChangedValues(c_int begin,
+                           c_int end,
+                           const c_float* oldValues,
+                           const T* newValues,
+                           c_int* indices,
+                           c_float* values)
+{
+    // a block fills a 512 bit register in double precision
+    constexpr c_int blockSize = 8;
+
+    // each element is written and kept only if it is changed, hence no branch depends on the
+    // single values. The next element is always written at a position lower than its own one
+    c_int numberOfChangedValues = begin;
+    const auto writeValue = [&](const c_int position, const bool isChanged) {
+        indices[numberOfChangedValues] = position;
+        values[numberOfChangedValues] = static_cast<c_float>(newValues[position]);
+        numberOfChangedValues += static_cast<c_int>(isChanged);
+    };
+
+    c_int block = begin;
+    for (; block + blockSize <= end; block += blockSize)
+    {
+        // the loop has a fixed size and no branches, hence the compiler can turn it in a vector
+        // comparison followed by a mask extraction. The blocks without changes are skipped
+        std::uint32_t mask = 0;
+        for (c_int j = 0; j < blockSize; j++)
+        {
+            const c_float value = static_cast<c_float>(newValues[block + j]);
+            mask |= static_cast<std::uint32_t>(value != oldValues[block + j]) << j;
+        }
+
+        if (mask == 0)
+        {
+            continue;
+        }
+
+        for (c_int j = 0; j < blockSize; j++)
+        {
+            writeValue(block + j, ((mask >> j) & 1U) != 0);
+        }
+    }
+
+    for (; block < end; block++)
+    {
+        writeValue(block, static_cast<c_float>(newValues[block]) != oldValues[block]);
+    }
+
+    return numberOfChangedValues - begin;
+}
+} // namespace detail
+} // namespace SparseMatrixHelper
+} // namespace OsqpEigen
+
+template <typename IndexA, typename IndexB>
+bool OsqpEigen::SparseMatrixHelper::isSparsityPatternEqual(c_int numberOfColumns,
+                                                           const IndexA* outerIndex,
+                                                           const IndexA* innerIndex,
+                                                           const IndexB* otherOuterIndex,
+                                                           const IndexB* otherInnerIndex)
+{
+    // the number of non zeros is the last column pointer, hence it is compared first
+    const std::size_t numberOfOuterIndices = static_cast<std::size_t>(numberOfColumns) + 1;
+    if (!detail::areIndicesEqual(outerIndex, otherOuterIndex, numberOfOuterIndices))
+    {
+        return false;
+    }
+
+    const c_int numberOfNonZeros = static_cast<c_int>(outerIndex[numberOfColumns]);
+    const std::size_t numberOfRanges = detail::numberOfParallelRanges(numberOfNonZeros);
+    if (numberOfRanges == 1)
+    {
+        return detail::areIndicesEqual(innerIndex,
+                                       otherInnerIndex,
+                                       static_cast<std::size_t>(numberOfNonZeros));
+    }
+
+    // the inner indices are split in ranges of the same size compared in parallel
+    std::atomic<bool> isEqual{true};
+    detail::parallelFor(numberOfRanges, [&](std::size_t range) {
+        const c_int begin = detail::rangeBegin(range, numberOfRanges, numberOfNonZeros);
+        const c_int end = detail::rangeBegin(range + 1, numberOfRanges, numberOfNonZeros);
+        if (isEqual.load(std::memory_order_relaxed)
+            && !detail::areIndicesEqual(innerIndex + begin,
+                                        otherInnerIndex + begin,
+                                        static_cast<std::size_t>(end - begin)))
+        {
+            isEqual.store(false, std::memory_order_relaxed);
+        }
+    });
+    return isEqual.load();
+}
+
+template <typename T>
+void OsqpEigen::SparseMatrixHelper::evaluateChangedValues(c_int numberOfNonZeros,
+                                                          const c_float* oldValues,
+                                                          const T* newValues,
+                                                          std::vector<c_int>& changedIndices,
+                                                          std::vector<c_float>& changedValues)
+{
+    // the vectors are enlarged to contain all the values and shrunk at the end. Only the elements
+    // beyond the previous size are initialized by resize()
+    changedIndices.resize(static_cast<std::size_t>(numberOfNonZeros));
+    changedValues.resize(static_cast<std::size_t>(numberOfNonZeros));
+    c_int* indices = changedIndices.data();
+    c_float* values = changedValues.data();
+
+    const std::size_t numberOfRanges = detail::numberOfParallelRanges(numberOfNonZeros);
+    c_int numberOfChangedValues = 0;
+    if (numberOfRanges == 1)
+    {
+        numberOfChangedValues = detail::compactChangedValues(0,
+                                                             numberOfNonZeros,
+                                                             oldValues,
+                                                             newValues,
+                                                             indices,
+                                                             values);
+    } else
+    {
+        // each range is compacted at its own beginning, then the ranges are moved one after the
+        // other. A range is never moved forward, hence the copies do not overwrite the elements
+        // still to be moved. std::copy requires the destination to be outside the source range,
+        // the ranges already in place are skipped
+        std::array<c_int, maximumNumberOfParallelThreads> numberOfChangedValuesPerRange;
+        detail::parallelFor(numberOfRanges, [&](std::size_t range) {
+            numberOfChangedValuesPerRange[range] = detail::compactChangedValues(
+                detail::rangeBegin(range, numberOfRanges, numberOfNonZeros),
+                detail::rangeBegin(range + 1, numberOfRanges, numberOfNonZeros),
+                oldValues,
+                newValues,
+                indices,
+                values);
+        });
+
+        for (std::size_t range = 0; range < numberOfRanges; range++)
+        {
+            const c_int begin = detail::rangeBegin(range, numberOfRanges, numberOfNonZeros);
+            const c_int size = numberOfChangedValuesPerRange[range];
+            if (begin != numberOfChangedValues)
+            {
+                std::copy(indices + begin, indices + begin + size, indices + numberOfChangedValues);
+                std::copy(values + begin, values + begin + size, values + numberOfChangedValues);
+            }
+            numberOfChangedValues += size;
+        }
+    }
+
+    changedIndices.resize(static_cast<std::size_t>(numberOfChangedValues));
+    changedValues.resize(static_cast<std::size_t>(numberOfChangedValues));
+}
@@ -0,0 +1,102 @@
+/**
+ * @file ThreadPool.hpp
+ * @copyright  Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_THREAD_POOL_HPP
+#define OSQPEIGEN_THREAD_POOL_HPP
+
+// Std
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * OsqpEigen namespace.
+ */
+namespace OsqpEigen
+{
+/**
+ * ThreadPool class is a fixed size pool of worker threads used to run independent tasks in
+ * parallel. The tasks are distributed dynamically: each thread takes the next task available as
+ * soon as it finishes the previous one, hence tasks with different durations are balanced
+ * among the threads.
+ */
+class ThreadPool
+{
+    std::vector<std::thread> m_threads; /**< Worker threads. */
+    std::mutex m_mutex; /**< Mutex protecting the state of the pool. */
+    std::mutex m_parallelForMutex; /**< Mutex serializing the calls of parallelFor(). */
+    std::condition_variable m_taskCondition; /**< Used to wake up the workers. */
+    std::condition_variable m_doneCondition; /**< Used to notify the end of the tasks. */
+    const std::function<void(std::size_t)>* m_task; /**< Task currently executed. */
+    std::size_t m_numberOfTasks; /**< Number of tasks currently executed. */
+    std::atomic<std::size_t> m_nextTask; /**< Index of the next task to be executed. */
+    std::size_t m_numberOfActiveWorkers; /**< Number of workers still running tasks. */
+    std::size_t m_generation; /**< Incremented every time new tasks are submitted. */
+    bool m_stop; /**< Boolean true if the workers have to be stopped. */
+
+    /**
+     * Run the tasks until all of them are taken.
+     */
+    void runTasks();
+
+    /**
+     * Loop executed by the worker threads.
+     */
+    void workerLoop();
+
+    /**
+     * Run task(i) for each i in [0, numberOfTasks) and wait until all the tasks are completed.
+     * The caller has to lock m_parallelForMutex.
+     * @param numberOfTasks is the number of tasks;
+     * @param task is the function called with the index of the task.
+     */
+    void runParallelFor(std::size_t numberOfTasks, const std::function<void(std::size_t)>& task);
+
+public:
+    /**
+     * Constructor.
+     * @param numberOfThreads is the number of worker threads. The thread calling parallelFor()
+     * runs the tasks as well, hence if it is equal to zero all the tasks are run sequentially.
+     */
+    explicit ThreadPool(std::size_t numberOfThreads);
+
+    /**
+     * Deconstructor. The worker threads are joined.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Get the number of worker threads.
+     * @return the number of worker threads.
+     */
+    std::size_t getNumberOfThreads() const;
+
+    /**
+     * Run task(i) for each i in [0, numberOfTasks) and wait until all the tasks are completed.
+     * @param numberOfTasks is the number of tasks;
+     * @param task is the function called with the index of the task. It has to be thread safe.
+     */
+    void parallelFor(std::size_t numberOfTasks, const std::function<void(std::size_t)>& task);
+
+    /**
+     * Run task(i) for each i in [0, numberOfTasks) if the pool is not running the tasks of another
+     * call, and wait until all the tasks are completed.
+     * @param numberOfTasks is the number of tasks;
+     * @param task is the function called with the index of the task. It has to be thread safe.
+     * @return true if the tasks have been run, false if the pool is busy.
+     */
+    bool tryParallelFor(std::size_t numberOfTasks, const std::function<void(std::size_t)>& task);
+};
+} // namespace OsqpEigen
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file AsyncSolveWorker.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Std
+#include <exception>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// OsqpEigen
+#include <OsqpEigen/AsyncSolveWorker.hpp>
+#include <OsqpEigen/Logging.hpp>
+
+OsqpEigen::AsyncSolveWorker::AsyncSolveWorker(c_int numberOfVariables, c_int numberOfConstraints)
+    : m_numberOfPendingSolves(0)
+    , m_stop(false)
+    , m_isGradientQueued(false)
+    , m_isLowerBoundQueued(false)
+    , m_isUpperBoundQueued(false)
+{
+    // the vectors are queued without allocating memory
+    m_gradient.resize(numberOfVariables);
+    m_lowerBound.resize(numberOfConstraints);
+    m_upperBound.resize(numberOfConstraints);
+
+    m_thread = std::thread(&AsyncSolveWorker::workerLoop, this);
+}
+
+OsqpEigen::AsyncSolveWorker::~AsyncSolveWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_taskCondition.notify_one();
+    m_thread.join();
+}
+
+void OsqpEigen::AsyncSolveWorker::workerLoop()
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskCondition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+
+            // the submitted solves are completed before stopping
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        // an exception thrown by the solve, e.g. by the completion callback, is forwarded to the
+        // future instead of terminating the worker thread
+        OsqpEigen::ErrorExitFlag exitFlag = OsqpEigen::ErrorExitFlag::NoError;
+        std::exception_ptr exception;
+        try
+        {
+            exitFlag = task.solve();
+        } catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        // the solve is not pending anymore when the future is ready
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_numberOfPendingSolves--;
+        }
+        if (exception)
+        {
+            task.promise.set_exception(exception);
+        } else
+        {
+            task.promise.set_value(exitFlag);
+        }
+    }
+}
+
+bool OsqpEigen::AsyncSolveWorker::isWorkerThread() const
+{
+    return std::this_thread::get_id() == m_thread.get_id();
+}
+
+void OsqpEigen::AsyncSolveWorker::clearQueuedUpdates()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isGradientQueued = false;
+    m_isLowerBoundQueued = false;
+    m_isUpperBoundQueued = false;
+}
+
+bool OsqpEigen::AsyncSolveWorker::setCpuAffinity(int cpu)
+{
+#ifdef __linux__
+    if ((cpu < 0) || (cpu >= CPU_SETSIZE))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::AsyncSolveWorker::setCpuAffinity] The index of the CPU "
+                             "is not valid.");
+        return false;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    if (pthread_setaffinity_np(m_thread.native_handle(), sizeof(cpu_set_t), &cpuSet) != 0)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::AsyncSolveWorker::setCpuAffinity] Unable to pin the "
+                             "worker thread to the CPU " << cpu << ".");
+        return false;
+    }
+    return true;
+#else
+    OSQP_EIGEN_LOG_ERROR("[OsqpEigen::AsyncSolveWorker::setCpuAffinity] The CPU affinity is "
+                         "supported only on Linux.");
+    return false;
+#endif
+}
+
+std::future<OsqpEigen::ErrorExitFlag>
+OsqpEigen::AsyncSolveWorker::submit(std::function<OsqpEigen::ErrorExitFlag()> solve)
+{
+    Task task;
+    task.solve = std::move(solve);
+    std::future<OsqpEigen::ErrorExitFlag> future = task.promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+        m_numberOfPendingSolves++;
+    }
+    m_taskCondition.notify_one();
+    return future;
+}
+
+bool OsqpEigen::AsyncSolveWorker::queue(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& vector,
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1>& queuedVector,
+    bool& isQueued)
+{
+    // if no solve is pending the vector is sent to the workspace by the caller, hence the queued
+    // one is older and it has to be dropped
+    isQueued = (m_numberOfPendingSolves > 0);
+    if (isQueued)
+    {
+        queuedVector = vector;
+    }
+    return isQueued;
+}
+
+bool OsqpEigen::AsyncSolveWorker::queueGradient(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& gradient)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return queue(gradient, m_gradient, m_isGradientQueued);
+}
+
+OsqpEigen::AsyncSolveWorker::QueueResult OsqpEigen::AsyncSolveWorker::queueLowerBound(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if ((m_numberOfPendingSolves > 0) && m_isUpperBoundQueued
+        && (lowerBound.array() > m_upperBound.array()).any())
+    {
+        return QueueResult::Rejected;
+    }
+    return queue(lowerBound, m_lowerBound, m_isLowerBoundQueued) ? QueueResult::Queued
+                                                                 : QueueResult::NotQueued;
+}
+
+OsqpEigen::AsyncSolveWorker::QueueResult OsqpEigen::AsyncSolveWorker::queueUpperBound(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if ((m_numberOfPendingSolves > 0) && m_isLowerBoundQueued
+        && (m_lowerBound.array() > upperBound.array()).any())
+    {
+        return QueueResult::Rejected;
+    }
+    return queue(upperBound, m_upperBound, m_isUpperBoundQueued) ? QueueResult::Queued
+                                                                 : QueueResult::NotQueued;
+}
+
+OsqpEigen::AsyncSolveWorker::QueueResult OsqpEigen::AsyncSolveWorker::queueBounds(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound)
+{
+    // both the bounds are queued or sent to the workspace, so that they are consistent
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if ((m_numberOfPendingSolves > 0) && (lowerBound.array() > upperBound.array()).any())
+    {
+        return QueueResult::Rejected;
+    }
+    queue(lowerBound, m_lowerBound, m_isLowerBoundQueued);
+    return queue(upperBound, m_upperBound, m_isUpperBoundQueued) ? QueueResult::Queued
+                                                                 : QueueResult::NotQueued;
+}
+
+bool OsqpEigen::AsyncSolveWorker::applyQueuedUpdates(
+    const std::function<bool(const c_float*, const c_float*, const c_float*)>& update)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isGradientQueued && !m_isLowerBoundQueued && !m_isUpperBoundQueued)
+    {
+        return true;
+    }
+
+    const bool isUpdated = update(m_isGradientQueued ? m_gradient.data() : nullptr,
+                                  m_isLowerBoundQueued ? m_lowerBound.data() : nullptr,
+                                  m_isUpperBoundQueued ? m_upperBound.data() : nullptr);
+    m_isGradientQueued = false;
+    m_isLowerBoundQueued = false;
+    m_isUpperBoundQueued = false;
+    return isUpdated;
+}
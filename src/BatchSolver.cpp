@@ -0,0 +1,360 @@
+/**
+ * @file BatchSolver.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Std
+#include <algorithm>
+#include <thread>
+
+// OsqpEigen
+#include <OsqpEigen/BatchSolver.hpp>
+#include <OsqpEigen/Logging.hpp>
+
+OsqpEigen::BatchSolver::BatchSolver()
+    : m_isSolverInitialized(false)
+{
+    m_settings = std::make_unique<OsqpEigen::Settings>();
+    m_data = std::make_unique<OsqpEigen::Data>();
+}
+
+bool OsqpEigen::BatchSolver::initSolver(int numberOfProblems, int numberOfThreads)
+{
+    if (m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::initSolver] The solver has been already "
+                             "initialized. Please use clearSolver() method to deallocate memory.");
+        return false;
+    }
+
+    if (numberOfProblems <= 0)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::initSolver] The number of problems has to "
+                             "be positive.");
+        return false;
+    }
+
+    if (!m_data->isSet())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::initSolver] Some data are not set.");
+        return false;
+    }
+
+    const OSQPData* data = m_data->getData();
+    const c_int n = data->n;
+    const c_int m = data->m;
+
+    // the matrices of each problem are copied from the compressed-column arrays stored in Data,
+    // hence all the problems have the same sparsity pattern. The hessian contains only the upper
+    // triangular part
+    const Eigen::Map<const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>>
+        hessian(n, n, data->P->p[n], data->P->p, data->P->i, data->P->x);
+
+    // the vectors of each problem are stored in the columns of a matrix. Their address does not
+    // change until the solver is cleared
+    m_gradients = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(data->q, n)
+                      .replicate(1, numberOfProblems);
+    if (m > 0)
+    {
+        m_lowerBounds = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(data->l, m)
+                            .replicate(1, numberOfProblems);
+        m_upperBounds = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(data->u, m)
+                            .replicate(1, numberOfProblems);
+    } else
+    {
+        m_lowerBounds.resize(0, numberOfProblems);
+        m_upperBounds.resize(0, numberOfProblems);
+    }
+
+    m_solvers.clear();
+    m_solvers.reserve(numberOfProblems);
+    for (int k = 0; k < numberOfProblems; k++)
+    {
+        auto solver = std::make_unique<OsqpEigen::Solver>();
+        *(solver->settings()->getSettings()) = *(m_settings->getSettings());
+
+        auto gradient = m_gradients.col(k);
+        solver->data()->setNumberOfVariables(static_cast<int>(n));
+        solver->data()->setNumberOfConstraints(static_cast<int>(m));
+        bool ok = solver->data()->setHessianMatrix(hessian, true);
+        ok = ok && solver->data()->setGradient(gradient);
+        if (m > 0)
+        {
+            auto lowerBound = m_lowerBounds.col(k);
+            auto upperBound = m_upperBounds.col(k);
+            const Eigen::Map<const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>>
+                linearConstraints(m, n, data->A->p[n], data->A->p, data->A->i, data->A->x);
+            ok = ok && solver->data()->setLinearConstraintsMatrix(linearConstraints);
+            ok = ok && solver->data()->setBounds(lowerBound, upperBound);
+        }
+
+        if (!ok)
+        {
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::initSolver] Unable to set the data of "
+                                 "the problem " << k << ".");
+            m_solvers.clear();
+            return false;
+        }
+
+        m_solvers.push_back(std::move(solver));
+    }
+
+    // the calling thread takes part in the solution of the problems
+    if (numberOfThreads <= 0)
+    {
+        numberOfThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    numberOfThreads = std::min(numberOfThreads, numberOfProblems);
+    m_threadPool = std::make_unique<OsqpEigen::ThreadPool>(numberOfThreads - 1);
+
+    // the workspaces are set up in parallel
+    std::vector<char> isInitialized(numberOfProblems, false);
+    m_threadPool->parallelFor(numberOfProblems, [&](std::size_t k) {
+        isInitialized[k] = m_solvers[k]->initSolver();
+    });
+
+    if (std::find(isInitialized.begin(), isInitialized.end(), false) != isInitialized.end())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::initSolver] Unable to initialize the solver "
+                             "of all the problems.");
+        m_solvers.clear();
+        m_threadPool.reset();
+        return false;
+    }
+
+    const csc* solverHessian = m_solvers.front()->data()->getData()->P;
+    const csc* solverLinearConstraints = m_solvers.front()->data()->getData()->A;
+    m_hessianValues = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(
+                          solverHessian->x, solverHessian->p[solverHessian->n])
+                          .replicate(1, numberOfProblems);
+    m_linearConstraintsValues = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(
+                                    solverLinearConstraints->x,
+                                    solverLinearConstraints->p[solverLinearConstraints->n])
+                                    .replicate(1, numberOfProblems);
+
+    m_solutions.setZero(n, numberOfProblems);
+    m_dualSolutions.setZero(m, numberOfProblems);
+    m_errorExitFlags.assign(numberOfProblems, OsqpEigen::ErrorExitFlag::NoError);
+    m_status.assign(numberOfProblems, OsqpEigen::Status::Unsolved);
+
+    m_pendingUpdates.assign(numberOfProblems, PendingUpdates());
+
+    m_isSolverInitialized = true;
+    return true;
+}
+
+bool OsqpEigen::BatchSolver::isInitialized() const
+{
+    return m_isSolverInitialized;
+}
+
+void OsqpEigen::BatchSolver::clearSolver()
+{
+    if (m_isSolverInitialized)
+    {
+        m_solvers.clear();
+        m_threadPool.reset();
+        m_isSolverInitialized = false;
+    }
+}
+
+int OsqpEigen::BatchSolver::getNumberOfProblems() const
+{
+    return static_cast<int>(m_solvers.size());
+}
+
+bool OsqpEigen::BatchSolver::checkSize(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& matrix,
+    Eigen::Index rows,
+    const char* functionName) const
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::" << functionName << "] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    if ((matrix.rows() != rows) || (matrix.cols() != getNumberOfProblems()))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::" << functionName << "] The matrix has to "
+                             "be a " << rows << " x " << getNumberOfProblems() << " matrix.");
+        return false;
+    }
+
+    return true;
+}
+
+bool OsqpEigen::BatchSolver::updateGradients(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& gradients)
+{
+    if (!checkSize(gradients, m_gradients.rows(), "updateGradients"))
+    {
+        return false;
+    }
+
+    m_gradients = gradients;
+    for (auto& pendingUpdates : m_pendingUpdates)
+    {
+        pendingUpdates.isGradientToUpdate = true;
+    }
+    return true;
+}
+
+bool OsqpEigen::BatchSolver::updateBounds(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& lowerBounds,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& upperBounds)
+{
+    if (!checkSize(lowerBounds, m_lowerBounds.rows(), "updateBounds")
+        || !checkSize(upperBounds, m_upperBounds.rows(), "updateBounds"))
+    {
+        return false;
+    }
+
+    m_lowerBounds = lowerBounds;
+    m_upperBounds = upperBounds;
+    for (auto& pendingUpdates : m_pendingUpdates)
+    {
+        pendingUpdates.areBoundsToUpdate = (m_lowerBounds.rows() > 0);
+    }
+    return true;
+}
+
+bool OsqpEigen::BatchSolver::updateHessianValues(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& hessianValues)
+{
+    if (!checkSize(hessianValues, m_hessianValues.rows(), "updateHessianValues"))
+    {
+        return false;
+    }
+
+    m_hessianValues = hessianValues;
+    for (auto& pendingUpdates : m_pendingUpdates)
+    {
+        pendingUpdates.isHessianToUpdate = true;
+    }
+    return true;
+}
+
+bool OsqpEigen::BatchSolver::updateLinearConstraintsValues(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>&
+        linearConstraintsValues)
+{
+    if (!checkSize(linearConstraintsValues,
+                   m_linearConstraintsValues.rows(),
+                   "updateLinearConstraintsValues"))
+    {
+        return false;
+    }
+
+    m_linearConstraintsValues = linearConstraintsValues;
+    for (auto& pendingUpdates : m_pendingUpdates)
+    {
+        pendingUpdates.isLinearConstraintsToUpdate = true;
+    }
+    return true;
+}
+
+OsqpEigen::ErrorExitFlag OsqpEigen::BatchSolver::solveProblems()
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::solveProblems] The solver has not been "
+                             "initialized yet. Please call initSolver() method.");
+        return OsqpEigen::ErrorExitFlag::WorkspaceNotInitError;
+    }
+
+    // the new data are sent to each solver by the thread solving the problem. A pending update
+    // is cleared only if it is sent, hence the data of a problem that failed are sent again by
+    // the next call
+    m_threadPool->parallelFor(m_solvers.size(), [this](std::size_t k) {
+        OsqpEigen::Solver& solver = *m_solvers[k];
+        PendingUpdates& pendingUpdates = m_pendingUpdates[k];
+
+        if (pendingUpdates.isGradientToUpdate)
+        {
+            pendingUpdates.isGradientToUpdate = !solver.updateGradient(m_gradients.col(k));
+        }
+        if (pendingUpdates.areBoundsToUpdate)
+        {
+            pendingUpdates.areBoundsToUpdate
+                = !solver.updateBounds(m_lowerBounds.col(k), m_upperBounds.col(k));
+        }
+        if (pendingUpdates.isHessianToUpdate)
+        {
+            pendingUpdates.isHessianToUpdate = !solver.updateHessianValues(m_hessianValues.col(k));
+        }
+        if (pendingUpdates.isLinearConstraintsToUpdate)
+        {
+            pendingUpdates.isLinearConstraintsToUpdate
+                = !solver.updateLinearConstraintsValues(m_linearConstraintsValues.col(k));
+        }
+
+        const bool isDataUpdated = !pendingUpdates.isGradientToUpdate
+                                   && !pendingUpdates.areBoundsToUpdate
+                                   && !pendingUpdates.isHessianToUpdate
+                                   && !pendingUpdates.isLinearConstraintsToUpdate;
+        if (!isDataUpdated)
+        {
+            m_errorExitFlags[k] = OsqpEigen::ErrorExitFlag::DataValidationError;
+            m_status[k] = OsqpEigen::Status::Unsolved;
+            return;
+        }
+
+        m_errorExitFlags[k] = solver.solveProblem();
+        if (m_errorExitFlags[k] != OsqpEigen::ErrorExitFlag::NoError)
+        {
+            m_status[k] = OsqpEigen::Status::Unsolved;
+            return;
+        }
+
+        m_status[k] = solver.getStatus();
+        m_solutions.col(k) = solver.solutionView();
+        m_dualSolutions.col(k) = solver.dualSolutionView();
+    });
+
+    for (const auto& errorExitFlag : m_errorExitFlags)
+    {
+        if (errorExitFlag != OsqpEigen::ErrorExitFlag::NoError)
+        {
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::BatchSolver::solveProblems] Unable to solve all the "
+                                 "problems.");
+            return errorExitFlag;
+        }
+    }
+
+    return OsqpEigen::ErrorExitFlag::NoError;
+}
+
+const std::vector<OsqpEigen::ErrorExitFlag>& OsqpEigen::BatchSolver::getErrorExitFlags() const
+{
+    return m_errorExitFlags;
+}
+
+const std::vector<OsqpEigen::Status>& OsqpEigen::BatchSolver::getStatus() const
+{
+    return m_status;
+}
+
+const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>&
+OsqpEigen::BatchSolver::getSolutions() const
+{
+    return m_solutions;
+}
+
+const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>&
+OsqpEigen::BatchSolver::getDualSolutions() const
+{
+    return m_dualSolutions;
+}
+
+const std::unique_ptr<OsqpEigen::Settings>& OsqpEigen::BatchSolver::settings() const
+{
+    return m_settings;
+}
+
+const std::unique_ptr<OsqpEigen::Data>& OsqpEigen::BatchSolver::data() const
+{
+    return m_data;
+}
@@ -10,7 +10,7 @@
 
 // OsqpEigen
 #include <OsqpEigen/Data.hpp>
-#include <OsqpEigen/Debug.hpp>
+#include <OsqpEigen/Logging.hpp>
 
 OsqpEigen::Data::Data()
     : m_isNumberOfVariablesSet(false),
@@ -19,7 +19,12 @@ OsqpEigen::Data::Data()
       m_isGradientSet(false),
       m_isLinearConstraintsMatrixSet(false),
       m_isLowerBoundSet(false),
-      m_isUpperBoundSet(false)
+      m_isUpperBoundSet(false),
+      m_isHessianMatrixBorrowed(false),
+      m_isLinearConstraintsMatrixBorrowed(false),
+      m_areVectorsCopied(false),
+      m_areVectorsDoubleBuffered(false),
+      m_frontBufferIndex(0)
 {
     m_data = (OSQPData *)c_malloc(sizeof(OSQPData));
     m_data->P = nullptr;
@@ -33,7 +38,12 @@ OsqpEigen::Data::Data(int n, int m)
       m_isGradientSet(false),
       m_isLinearConstraintsMatrixSet(false),
       m_isLowerBoundSet(false),
-      m_isUpperBoundSet(false)
+      m_isUpperBoundSet(false),
+      m_isHessianMatrixBorrowed(false),
+      m_isLinearConstraintsMatrixBorrowed(false),
+      m_areVectorsCopied(false),
+      m_areVectorsDoubleBuffered(false),
+      m_frontBufferIndex(0)
 {
     m_data = (OSQPData *)c_malloc(sizeof(OSQPData));
     m_data->P = nullptr;
@@ -48,7 +58,16 @@ void OsqpEigen::Data::clearHessianMatrix()
     if (m_isHessianMatrixSet)
     {
         m_isHessianMatrixSet = false;
-        OsqpEigen::spfree(m_data->P);
+        if (m_isHessianMatrixBorrowed)
+        {
+            // the arrays are owned by the user
+            OsqpEigen::spunwrap(m_data->P);
+            m_isHessianMatrixBorrowed = false;
+            m_borrowedHessianMatrix = BorrowedMatrix();
+        } else
+        {
+            OsqpEigen::spfree(m_data->P);
+        }
         m_data->P = nullptr;
     }
 }
@@ -58,11 +77,64 @@ void OsqpEigen::Data::clearLinearConstraintsMatrix()
     if (m_isLinearConstraintsMatrixSet)
     {
         m_isLinearConstraintsMatrixSet = false;
-        OsqpEigen::spfree(m_data->A);
+        if (m_isLinearConstraintsMatrixBorrowed)
+        {
+            // the arrays are owned by the user
+            OsqpEigen::spunwrap(m_data->A);
+            m_isLinearConstraintsMatrixBorrowed = false;
+            m_borrowedLinearConstraintsMatrix = BorrowedMatrix();
+        } else
+        {
+            OsqpEigen::spfree(m_data->A);
+        }
         m_data->A = nullptr;
     }
 }
 
+void OsqpEigen::Data::BorrowedMatrix::set(
+    const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& borrowedMatrix)
+{
+    matrix = &borrowedMatrix;
+    outerIndex = borrowedMatrix.outerIndexPtr();
+    innerIndex = borrowedMatrix.innerIndexPtr();
+    values = borrowedMatrix.valuePtr();
+    nonZeros = borrowedMatrix.nonZeros();
+}
+
+bool OsqpEigen::Data::BorrowedMatrix::isValid() const
+{
+    if (matrix == nullptr)
+    {
+        return true;
+    }
+
+    return (matrix->outerIndexPtr() == outerIndex) && (matrix->innerIndexPtr() == innerIndex)
+           && (matrix->valuePtr() == values) && (matrix->nonZeros() == nonZeros)
+           && matrix->isCompressed();
+}
+
+bool OsqpEigen::Data::wrapOsqpSparseMatrix(
+    const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& matrix, csc*& osqpSparseMatrix)
+{
+    if (osqpSparseMatrix != nullptr)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::wrapOsqpSparseMatrix] osqpSparseMatrix pointer is "
+                             "not a null pointer!");
+        return false;
+    }
+
+    // the arrays of a compressed column major matrix are already in the osqp format. osqp never
+    // writes in the data matrices, hence the const_cast is safe
+    osqpSparseMatrix = OsqpEigen::spwrap(static_cast<c_int>(matrix.rows()),
+                                         static_cast<c_int>(matrix.cols()),
+                                         static_cast<c_int>(matrix.nonZeros()),
+                                         const_cast<c_float*>(matrix.valuePtr()),
+                                         const_cast<c_int*>(matrix.innerIndexPtr()),
+                                         const_cast<c_int*>(matrix.outerIndexPtr()));
+
+    return osqpSparseMatrix != nullptr;
+}
+
 OsqpEigen::Data::~Data()
 {
     clearHessianMatrix();
@@ -87,6 +159,116 @@ auto OsqpEigen::Data::getData() const -> OSQPData *const &
     return m_data;
 }
 
+bool OsqpEigen::Data::borrowHessianMatrix(
+    const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& hessianMatrix)
+{
+    if (m_isHessianMatrixSet)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowHessianMatrix] The hessian matrix was "
+                             "already set. Please use clearHessianMatrix() method to deallocate "
+                             "memory.");
+        return false;
+    }
+
+    if (!m_isNumberOfVariablesSet)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowHessianMatrix] Please set the number of "
+                             "variables before add the hessian matrix.");
+        return false;
+    }
+
+    if ((hessianMatrix.rows() != m_data->n) || (hessianMatrix.cols() != m_data->n))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowHessianMatrix] The Hessian matrix has to be "
+                             "a n x n size matrix.");
+        return false;
+    }
+
+    if (!hessianMatrix.isCompressed())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowHessianMatrix] The Hessian matrix has to be "
+                             "compressed.");
+        return false;
+    }
+
+    // the row indices of each column are sorted, hence it is enough to check the last one
+    const c_int* outerIndex = hessianMatrix.outerIndexPtr();
+    const c_int* innerIndex = hessianMatrix.innerIndexPtr();
+    for (c_int k = 0; k < m_data->n; k++)
+    {
+        if ((outerIndex[k + 1] > outerIndex[k]) && (innerIndex[outerIndex[k + 1] - 1] > k))
+        {
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowHessianMatrix] Only the upper triangular "
+                                 "part of the Hessian matrix can be borrowed.");
+            return false;
+        }
+    }
+
+    if (!wrapOsqpSparseMatrix(hessianMatrix, m_data->P))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowHessianMatrix] Unable to instantiate the "
+                             "osqp sparse matrix.");
+        return false;
+    }
+
+    m_borrowedHessianMatrix.set(hessianMatrix);
+    m_isHessianMatrixBorrowed = true;
+    m_isHessianMatrixSet = true;
+    return true;
+}
+
+bool OsqpEigen::Data::borrowLinearConstraintsMatrix(
+    const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& linearConstraintsMatrix)
+{
+    if (m_isLinearConstraintsMatrixSet)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowLinearConstraintsMatrix] The linear "
+                             "constraint matrix was already set. Please use "
+                             "clearLinearConstraintsMatrix() method to deallocate memory.");
+        return false;
+    }
+
+    if (!m_isNumberOfConstraintsSet || !m_isNumberOfVariablesSet)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowLinearConstraintsMatrix] Please set the "
+                             "number of variables and constraints before add the constraint "
+                             "matrix.");
+        return false;
+    }
+
+    if ((linearConstraintsMatrix.rows() != m_data->m)
+        || (linearConstraintsMatrix.cols() != m_data->n))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowLinearConstraintsMatrix] The Linear "
+                             "constraints matrix has to be a m x n size matrix.");
+        return false;
+    }
+
+    if (!linearConstraintsMatrix.isCompressed())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowLinearConstraintsMatrix] The Linear "
+                             "constraints matrix has to be compressed.");
+        return false;
+    }
+
+    if (!wrapOsqpSparseMatrix(linearConstraintsMatrix, m_data->A))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::borrowLinearConstraintsMatrix] osqp sparse matrix "
+                             "not created.");
+        return false;
+    }
+
+    m_borrowedLinearConstraintsMatrix.set(linearConstraintsMatrix);
+    m_isLinearConstraintsMatrixBorrowed = true;
+    m_isLinearConstraintsMatrixSet = true;
+    return true;
+}
+
+bool OsqpEigen::Data::areBorrowedMatricesValid() const
+{
+    return m_borrowedHessianMatrix.isValid() && m_borrowedLinearConstraintsMatrix.isValid();
+}
+
 bool OsqpEigen::Data::isSet() const
 {
     const bool areConstraintsOk = (m_data->m == 0) ||
@@ -101,16 +283,112 @@ bool OsqpEigen::Data::isSet() const
            areConstraintsOk;
 }
 
+void OsqpEigen::Data::setVectorsCopy(bool copyVectors, bool isDoubleBuffered)
+{
+    m_areVectorsCopied = copyVectors;
+    m_areVectorsDoubleBuffered = copyVectors && isDoubleBuffered;
+    m_frontBufferIndex = 0;
+    m_vectorsBuffers = std::array<VectorsBuffer, 2>();
+
+    // the OSQPData struct may point to vectors that are not valid anymore
+    m_isGradientSet = false;
+    m_isLowerBoundSet = false;
+    m_isUpperBoundSet = false;
+}
+
+bool OsqpEigen::Data::swapVectorsBuffers()
+{
+    if (!m_areVectorsDoubleBuffered)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::swapVectorsBuffers] The vectors are not double "
+                             "buffered. Please call setVectorsCopy(true, true).");
+        return false;
+    }
+
+    m_frontBufferIndex = 1 - m_frontBufferIndex;
+
+    VectorsBuffer& front = m_vectorsBuffers[m_frontBufferIndex];
+    m_isGradientSet = front.isGradientSet;
+    m_isLowerBoundSet = front.isLowerBoundSet;
+    m_isUpperBoundSet = front.isUpperBoundSet;
+    m_data->q = front.gradient.data();
+    m_data->l = front.lowerBound.data();
+    m_data->u = front.upperBound.data();
+    return true;
+}
+
+bool OsqpEigen::Data::areVectorsCopied() const
+{
+    return m_areVectorsCopied;
+}
+
+bool OsqpEigen::Data::areVectorsDoubleBuffered() const
+{
+    return m_areVectorsDoubleBuffered;
+}
+
+OsqpEigen::Data::VectorsBuffer& OsqpEigen::Data::writableVectorsBuffer()
+{
+    return m_areVectorsDoubleBuffered ? m_vectorsBuffers[1 - m_frontBufferIndex]
+                                      : m_vectorsBuffers[m_frontBufferIndex];
+}
+
+void OsqpEigen::Data::commitCopiedGradient()
+{
+    VectorsBuffer& buffer = writableVectorsBuffer();
+    buffer.isGradientSet = true;
+
+    // a double buffered vector is used by the solver only after swapVectorsBuffers()
+    if (!m_areVectorsDoubleBuffered)
+    {
+        m_isGradientSet = true;
+        m_data->q = buffer.gradient.data();
+    }
+}
+
+void OsqpEigen::Data::commitCopiedLowerBound()
+{
+    VectorsBuffer& buffer = writableVectorsBuffer();
+    buffer.isLowerBoundSet = true;
+
+    if (!m_areVectorsDoubleBuffered)
+    {
+        m_isLowerBoundSet = true;
+        m_data->l = buffer.lowerBound.data();
+    }
+}
+
+void OsqpEigen::Data::commitCopiedUpperBound()
+{
+    VectorsBuffer& buffer = writableVectorsBuffer();
+    buffer.isUpperBoundSet = true;
+
+    if (!m_areVectorsDoubleBuffered)
+    {
+        m_isUpperBoundSet = true;
+        m_data->u = buffer.upperBound.data();
+    }
+}
+
 bool OsqpEigen::Data::setGradient(Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> gradient)
 {
     if (gradient.rows() != m_data->n)
     {
-        debugStream() << "[OsqpEigen::Data::setGradient] The size of the gradient must be equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setGradient] The size of the gradient must be "
+                             "equal to the number of the variables.");
         return false;
     }
-    m_isGradientSet = true;
-    m_data->q = gradient.data();
+
+    if (!m_areVectorsCopied)
+    {
+        m_isGradientSet = true;
+        m_data->q = gradient.data();
+        return true;
+    }
+
+    // the memory is allocated only if the size of the vector changes
+    writableVectorsBuffer().gradient = gradient;
+    commitCopiedGradient();
     return true;
 }
 
@@ -123,12 +401,20 @@ bool OsqpEigen::Data::setLowerBound(Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dyn
 {
     if (lowerBound.rows() != m_data->m)
     {
-        debugStream() << "[OsqpEigen::Data::setLowerBound] The size of the lower bound must be equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setLowerBound] The size of the lower bound must be "
+                             "equal to the number of the constraints.");
         return false;
     }
-    m_isLowerBoundSet = true;
-    m_data->l = lowerBound.data();
+
+    if (!m_areVectorsCopied)
+    {
+        m_isLowerBoundSet = true;
+        m_data->l = lowerBound.data();
+        return true;
+    }
+
+    writableVectorsBuffer().lowerBound = lowerBound;
+    commitCopiedLowerBound();
     return true;
 }
 
@@ -136,12 +422,20 @@ bool OsqpEigen::Data::setUpperBound(Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dyn
 {
     if (upperBound.rows() != m_data->m)
     {
-        debugStream() << "[OsqpEigen::Data::setUpperBound] The size of the upper bound must be equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Data::setUpperBound] The size of the upper bound must be "
+                             "equal to the number of the constraints.");
         return false;
     }
-    m_isUpperBoundSet = true;
-    m_data->u = upperBound.data();
+
+    if (!m_areVectorsCopied)
+    {
+        m_isUpperBoundSet = true;
+        m_data->u = upperBound.data();
+        return true;
+    }
+
+    writableVectorsBuffer().upperBound = upperBound;
+    commitCopiedUpperBound();
     return true;
 }
 
@@ -0,0 +1,164 @@
+/**
+ * @file EventTrace.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Std
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <thread>
+
+// OsqpEigen
+#include <OsqpEigen/EventTrace.hpp>
+
+namespace
+{
+std::int64_t now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+const char* OsqpEigen::solverEventTypeName(SolverEventType type)
+{
+    switch (type)
+    {
+    case SolverEventType::InitSolver:
+        return "initSolver";
+    case SolverEventType::HessianReinitialization:
+        return "hessianReinitialization";
+    case SolverEventType::LinearConstraintsReinitialization:
+        return "linearConstraintsReinitialization";
+    case SolverEventType::SolveProblem:
+        return "solveProblem";
+    }
+    return "unknown";
+}
+
+OsqpEigen::EventRingBuffer::EventRingBuffer(std::size_t capacity)
+    : m_queue(capacity)
+    , m_droppedEvents(0)
+{
+}
+
+std::size_t OsqpEigen::EventRingBuffer::capacity() const
+{
+    return m_queue.capacity();
+}
+
+bool OsqpEigen::EventRingBuffer::push(const SolverEvent& event) noexcept
+{
+    if (!m_queue.push(event))
+    {
+        m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool OsqpEigen::EventRingBuffer::pop(SolverEvent& event) noexcept
+{
+    return m_queue.pop(event);
+}
+
+std::size_t OsqpEigen::EventRingBuffer::drain(std::vector<SolverEvent>& events)
+{
+    std::size_t numberOfEvents = 0;
+    SolverEvent event;
+    while (pop(event))
+    {
+        events.push_back(event);
+        numberOfEvents++;
+    }
+    return numberOfEvents;
+}
+
+std::size_t OsqpEigen::EventRingBuffer::droppedEvents() const
+{
+    return m_droppedEvents.load(std::memory_order_relaxed);
+}
+
+OsqpEigen::SolverEventScope::SolverEventScope(EventRingBuffer* buffer,
+                                              SolverEventType type,
+                                              const void* solver) noexcept
+    : m_buffer(buffer)
+{
+    if (m_buffer == nullptr)
+    {
+        return;
+    }
+
+    m_event.type = type;
+    m_event.solver = reinterpret_cast<std::uintptr_t>(solver);
+    m_event.thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+    m_event.exitFlag = -1;
+    m_event.beginTime = now();
+}
+
+OsqpEigen::SolverEventScope::~SolverEventScope()
+{
+    if (m_buffer == nullptr)
+    {
+        return;
+    }
+
+    m_event.endTime = now();
+    m_buffer->push(m_event);
+}
+
+void OsqpEigen::SolverEventScope::setExitFlag(int exitFlag) noexcept
+{
+    m_event.exitFlag = exitFlag;
+}
+
+void OsqpEigen::SolverEventScope::setStatus(int status) noexcept
+{
+    m_event.status = status;
+}
+
+bool OsqpEigen::writeChromeTrace(const std::vector<SolverEvent>& events, std::ostream& stream)
+{
+    // the complete events ("ph":"X") require the times in microseconds. Every solver is shown
+    // as a different track of the same process
+    const std::ios_base::fmtflags flags = stream.flags();
+    const std::streamsize precision = stream.precision();
+    stream << std::fixed << std::setprecision(3);
+
+    stream << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        const SolverEvent& event = events[i];
+        const double begin = static_cast<double>(event.beginTime) / 1000.0;
+        const double duration = static_cast<double>(event.endTime - event.beginTime) / 1000.0;
+        stream << (i == 0 ? "\n" : ",\n") << "{\"name\":\"" << solverEventTypeName(event.type)
+               << "\",\"cat\":\"OsqpEigen\",\"ph\":\"X\",\"pid\":0"
+               << ",\"tid\":" << event.solver << ",\"ts\":" << begin << ",\"dur\":" << duration
+               << ",\"args\":{\"thread\":" << event.thread << ",\"exitFlag\":" << event.exitFlag
+               << ",\"status\":" << event.status << "}}";
+    }
+    stream << "\n]}" << std::endl;
+
+    stream.flags(flags);
+    stream.precision(precision);
+
+    return stream.good();
+}
+
+bool OsqpEigen::writeCsv(const std::vector<SolverEvent>& events, std::ostream& stream)
+{
+    stream << "type,solver,thread,begin_ns,end_ns,duration_ns,exit_flag,status\n";
+    for (const SolverEvent& event : events)
+    {
+        stream << solverEventTypeName(event.type) << "," << event.solver << "," << event.thread
+               << "," << event.beginTime << "," << event.endTime << ","
+               << event.endTime - event.beginTime << "," << event.exitFlag << ","
+               << event.status << "\n";
+    }
+    stream.flush();
+
+    return stream.good();
+}
@@ -0,0 +1,329 @@
+/**
+ * @file Logging.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Std
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+// OsqpEigen
+#include <OsqpEigen/BoundedQueue.hpp>
+#include <OsqpEigen/Logging.hpp>
+
+namespace
+{
+/**
+ * Message queued by the thread that logs it.
+ */
+struct LogRecord
+{
+    OsqpEigen::LogLevel level{OsqpEigen::LogLevel::Off};
+    char message[OsqpEigen::Logging::maxMessageLength]{};
+};
+
+/**
+ * Logger contains the queue of the messages and the background thread that writes them.
+ */
+class Logger
+{
+    static constexpr std::size_t queueCapacity = 1024;
+
+    OsqpEigen::BoundedQueue<LogRecord> m_queue;
+    std::atomic<std::size_t> m_droppedMessages;
+
+    std::mutex m_sinkMutex; /**< Protects the sink, it is locked only by the writing threads. */
+    std::shared_ptr<OsqpEigen::LogSink> m_sink;
+
+    std::mutex m_threadMutex; /**< Protects the thread and the stop request. */
+    std::condition_variable m_condition;
+    bool m_isStopRequested;
+    std::atomic<bool> m_hasQueuedMessages; /**< True if the thread has to be woken up. */
+    std::thread m_thread;
+
+    void writeQueuedMessages()
+    {
+        std::lock_guard<std::mutex> lock(m_sinkMutex);
+        LogRecord record;
+        while (m_queue.pop(record))
+        {
+            if (m_sink)
+            {
+                m_sink->write(record.level, record.message);
+            }
+        }
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_threadMutex);
+        while (true)
+        {
+            m_condition.wait(lock, [this]() {
+                return m_isStopRequested || m_hasQueuedMessages.load(std::memory_order_acquire);
+            });
+            if (m_isStopRequested)
+            {
+                return;
+            }
+
+            // the flag is cleared before popping the messages, hence a message queued while they
+            // are written wakes up the thread again
+            m_hasQueuedMessages.store(false, std::memory_order_release);
+            lock.unlock();
+            writeQueuedMessages();
+            lock.lock();
+        }
+    }
+
+public:
+    Logger()
+        : m_queue(queueCapacity)
+        , m_droppedMessages(0)
+        , m_sink(std::make_shared<OsqpEigen::StreamLogSink>(std::cerr))
+        , m_isStopRequested(false)
+        , m_hasQueuedMessages(false)
+    {
+        // the thread is started eagerly, so that the destructor of the messages never creates it.
+        // If it cannot be created the messages stay queued until start() or flush() are called
+        start();
+    }
+
+    ~Logger()
+    {
+        stop();
+    }
+
+    bool start() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        if (m_thread.joinable())
+        {
+            return true;
+        }
+
+        m_isStopRequested = false;
+        try
+        {
+            m_thread = std::thread(&Logger::run, this);
+        } catch (...)
+        {
+            return false;
+        }
+
+        // the messages queued while the thread was not running are written by the new thread
+        m_hasQueuedMessages.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void stop()
+    {
+        std::thread thread;
+        {
+            std::lock_guard<std::mutex> lock(m_threadMutex);
+            m_isStopRequested = true;
+            thread = std::move(m_thread);
+        }
+        m_condition.notify_one();
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+        writeQueuedMessages();
+    }
+
+    void push(const LogRecord& record)
+    {
+        if (!m_queue.push(record))
+        {
+            m_droppedMessages.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // the mutex is locked only when the queue stops being empty for the thread. Locking it
+        // before notifying guarantees that the wake up is not lost
+        if (!m_hasQueuedMessages.exchange(true, std::memory_order_acq_rel))
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_threadMutex);
+            }
+            m_condition.notify_one();
+        }
+    }
+
+    void setSink(std::shared_ptr<OsqpEigen::LogSink> sink)
+    {
+        std::lock_guard<std::mutex> lock(m_sinkMutex);
+        m_sink = std::move(sink);
+    }
+
+    void flush()
+    {
+        writeQueuedMessages();
+    }
+
+    std::size_t droppedMessages() const
+    {
+        return m_droppedMessages.load(std::memory_order_relaxed);
+    }
+};
+
+// the level is not stored in the logger, hence checking it neither constructs the logger nor
+// starts its thread
+std::atomic<int> runtimeLevel(static_cast<int>(OsqpEigen::LogLevel::Debug));
+
+Logger& logger()
+{
+    static Logger instance;
+    return instance;
+}
+
+const char* levelName(OsqpEigen::LogLevel level)
+{
+    switch (level)
+    {
+    case OsqpEigen::LogLevel::Debug:
+        return "debug";
+    case OsqpEigen::LogLevel::Info:
+        return "info";
+    case OsqpEigen::LogLevel::Warning:
+        return "warning";
+    case OsqpEigen::LogLevel::Error:
+        return "error";
+    case OsqpEigen::LogLevel::Off:
+        break;
+    }
+    return "";
+}
+} // namespace
+
+OsqpEigen::StreamLogSink::StreamLogSink(std::ostream& stream)
+    : m_stream(stream)
+{
+}
+
+void OsqpEigen::StreamLogSink::write(LogLevel level, const char* message)
+{
+    m_stream << "[" << levelName(level) << "] " << message << std::endl;
+}
+
+void OsqpEigen::Logging::setSink(std::shared_ptr<LogSink> sink)
+{
+    logger().setSink(std::move(sink));
+}
+
+void OsqpEigen::Logging::setLevel(LogLevel level)
+{
+    runtimeLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+OsqpEigen::LogLevel OsqpEigen::Logging::getLevel()
+{
+    return static_cast<LogLevel>(runtimeLevel.load(std::memory_order_relaxed));
+}
+
+bool OsqpEigen::Logging::isLevelEnabled(LogLevel level)
+{
+    return (level != LogLevel::Off)
+           && (static_cast<int>(level) >= runtimeLevel.load(std::memory_order_relaxed));
+}
+
+bool OsqpEigen::Logging::start()
+{
+    return logger().start();
+}
+
+void OsqpEigen::Logging::stop()
+{
+    logger().stop();
+}
+
+void OsqpEigen::Logging::flush()
+{
+    logger().flush();
+}
+
+std::size_t OsqpEigen::Logging::droppedMessages()
+{
+    return logger().droppedMessages();
+}
+
+OsqpEigen::Logging::MessageBuilder::MessageBuilder(LogLevel level) noexcept
+    : m_level(level)
+    , m_length(0)
+{
+    m_message[0] = '\0';
+}
+
+OsqpEigen::Logging::MessageBuilder::~MessageBuilder()
+{
+    LogRecord record;
+    record.level = m_level;
+    std::memcpy(record.message, m_message, m_length + 1);
+
+    // the construction of the logger may throw, the message is discarded in that case
+    try
+    {
+        logger().push(record);
+    } catch (...)
+    {
+    }
+}
+
+void OsqpEigen::Logging::MessageBuilder::append(const char* string, std::size_t length) noexcept
+{
+    // the message is truncated if it does not fit in the buffer
+    const std::size_t available = maxMessageLength - 1 - m_length;
+    const std::size_t copied = length < available ? length : available;
+    std::memcpy(m_message + m_length, string, copied);
+    m_length += copied;
+    m_message[m_length] = '\0';
+}
+
+void OsqpEigen::Logging::MessageBuilder::appendSigned(long long value) noexcept
+{
+    char buffer[32];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%lld", value);
+    append(buffer, static_cast<std::size_t>(length));
+}
+
+void OsqpEigen::Logging::MessageBuilder::appendUnsigned(unsigned long long value) noexcept
+{
+    char buffer[32];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%llu", value);
+    append(buffer, static_cast<std::size_t>(length));
+}
+
+void OsqpEigen::Logging::MessageBuilder::appendFloating(double value) noexcept
+{
+    char buffer[32];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+    append(buffer, static_cast<std::size_t>(length));
+}
+
+OsqpEigen::Logging::MessageBuilder&
+OsqpEigen::Logging::MessageBuilder::operator<<(const char* string) noexcept
+{
+    append(string, std::strlen(string));
+    return *this;
+}
+
+OsqpEigen::Logging::MessageBuilder&
+OsqpEigen::Logging::MessageBuilder::operator<<(const std::string& string) noexcept
+{
+    append(string.data(), string.size());
+    return *this;
+}
+
+OsqpEigen::Logging::MessageBuilder&
+OsqpEigen::Logging::MessageBuilder::operator<<(char character) noexcept
+{
+    append(&character, 1);
+    return *this;
+}
@@ -0,0 +1,443 @@
+/**
+ * @file MPCProblemBuilder.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// OsqpEigen
+#include <OsqpEigen/Constants.hpp>
+#include <OsqpEigen/Logging.hpp>
+#include <OsqpEigen/MPCProblemBuilder.hpp>
+
+OsqpEigen::MPCProblemBuilder::MPCProblemBuilder(int numberOfStates,
+                                                int numberOfInputs,
+                                                int horizon)
+    : m_numberOfStates(numberOfStates)
+    , m_numberOfInputs(numberOfInputs)
+    , m_horizon(horizon)
+{
+    buildSparsityPattern();
+
+    m_gradient = Eigen::Matrix<c_float, Eigen::Dynamic, 1>::Zero(getNumberOfVariables());
+    m_stateReference = Eigen::Matrix<c_float, Eigen::Dynamic, 1>::Zero(m_numberOfStates);
+
+    // the dynamics are equality constraints, the bounds of the variables are infinite
+    const int numberOfDynamicsConstraints = m_numberOfStates * (m_horizon + 1);
+    m_lowerBound.resize(getNumberOfConstraints());
+    m_upperBound.resize(getNumberOfConstraints());
+    m_lowerBound.head(numberOfDynamicsConstraints).setZero();
+    m_upperBound.head(numberOfDynamicsConstraints).setZero();
+    m_lowerBound.tail(getNumberOfVariables()).setConstant(-OsqpEigen::INFTY);
+    m_upperBound.tail(getNumberOfVariables()).setConstant(OsqpEigen::INFTY);
+}
+
+int OsqpEigen::MPCProblemBuilder::getNumberOfVariables() const
+{
+    return m_numberOfStates * (m_horizon + 1) + m_numberOfInputs * m_horizon;
+}
+
+int OsqpEigen::MPCProblemBuilder::getNumberOfConstraints() const
+{
+    return m_numberOfStates * (m_horizon + 1) + getNumberOfVariables();
+}
+
+void OsqpEigen::MPCProblemBuilder::buildSparsityPattern()
+{
+    const c_int nx = m_numberOfStates;
+    const c_int nu = m_numberOfInputs;
+    const c_int horizon = m_horizon;
+    const c_int numberOfStateVariables = nx * (horizon + 1);
+    const c_int n = getNumberOfVariables();
+    const c_int m = getNumberOfConstraints();
+
+    // hessian: one dense upper triangular block per state and per input
+    m_hessian.resize(n, n);
+    m_hessian.resizeNonZeros((horizon + 1) * nx * (nx + 1) / 2 + horizon * nu * (nu + 1) / 2);
+    c_int* outer = m_hessian.outerIndexPtr();
+    c_int* inner = m_hessian.innerIndexPtr();
+    c_int index = 0;
+    for (c_int k = 0; k < horizon + 1; k++)
+    {
+        for (c_int j = 0; j < nx; j++)
+        {
+            outer[k * nx + j] = index;
+            for (c_int i = 0; i <= j; i++)
+            {
+                inner[index++] = k * nx + i;
+            }
+        }
+    }
+    for (c_int k = 0; k < horizon; k++)
+    {
+        for (c_int j = 0; j < nu; j++)
+        {
+            outer[numberOfStateVariables + k * nu + j] = index;
+            for (c_int i = 0; i <= j; i++)
+            {
+                inner[index++] = numberOfStateVariables + k * nu + i;
+            }
+        }
+    }
+    outer[n] = index;
+    m_hessian.coeffs().setZero();
+
+    // linear constraints: the column of a state contains the -1 of its own dynamics, the column
+    // of A_k in the dynamics of the next state (if any) and the 1 of its bound. The column of an
+    // input contains the column of B_k and the 1 of its bound. The rows are already sorted
+    m_linearConstraints.resize(m, n);
+    m_linearConstraints.resizeNonZeros(horizon * nx * (nx + 2) + 2 * nx
+                                       + horizon * nu * (nx + 1));
+    outer = m_linearConstraints.outerIndexPtr();
+    inner = m_linearConstraints.innerIndexPtr();
+    c_float* values = m_linearConstraints.valuePtr();
+    index = 0;
+    for (c_int k = 0; k < horizon + 1; k++)
+    {
+        for (c_int j = 0; j < nx; j++)
+        {
+            const c_int column = k * nx + j;
+            outer[column] = index;
+            inner[index] = column;
+            values[index++] = -1;
+            if (k < horizon)
+            {
+                for (c_int i = 0; i < nx; i++)
+                {
+                    inner[index] = (k + 1) * nx + i;
+                    values[index++] = 0;
+                }
+            }
+            inner[index] = numberOfStateVariables + column;
+            values[index++] = 1;
+        }
+    }
+    for (c_int k = 0; k < horizon; k++)
+    {
+        for (c_int j = 0; j < nu; j++)
+        {
+            const c_int column = numberOfStateVariables + k * nu + j;
+            outer[column] = index;
+            for (c_int i = 0; i < nx; i++)
+            {
+                inner[index] = (k + 1) * nx + i;
+                values[index++] = 0;
+            }
+            inner[index] = numberOfStateVariables + column;
+            values[index++] = 1;
+        }
+    }
+    outer[n] = index;
+}
+
+void OsqpEigen::MPCProblemBuilder::setHessianBlock(
+    c_int firstColumn,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& block)
+{
+    const c_int* outer = m_hessian.outerIndexPtr();
+    c_float* values = m_hessian.valuePtr();
+    for (c_int j = 0; j < block.cols(); j++)
+    {
+        const c_int offset = outer[firstColumn + j];
+        for (c_int i = 0; i <= j; i++)
+        {
+            values[offset + i] = block(i, j);
+        }
+    }
+}
+
+void OsqpEigen::MPCProblemBuilder::updateStageGradient(int stage)
+{
+    // q = -Q_k x_ref, where Q_k is stored as its upper triangular part
+    const c_int nx = m_numberOfStates;
+    const c_int* outer = m_hessian.outerIndexPtr();
+    const c_float* values = m_hessian.valuePtr();
+    auto gradient = m_gradient.segment(stage * nx, nx);
+    gradient.setZero();
+    for (c_int j = 0; j < nx; j++)
+    {
+        const c_int offset = outer[stage * nx + j];
+        for (c_int i = 0; i < j; i++)
+        {
+            gradient(i) -= values[offset + i] * m_stateReference(j);
+            gradient(j) -= values[offset + i] * m_stateReference(i);
+        }
+        gradient(j) -= values[offset + j] * m_stateReference(j);
+    }
+}
+
+bool OsqpEigen::MPCProblemBuilder::checkStage(int stage,
+                                              int numberOfStages,
+                                              const char* functionName) const
+{
+    if ((stage < 0) || (stage >= numberOfStages))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::MPCProblemBuilder::" << functionName << "] The stage "
+                             "has to be between 0 and " << numberOfStages - 1 << ".");
+        return false;
+    }
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::checkSize(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& matrix,
+    int rows,
+    int cols,
+    const char* functionName) const
+{
+    if ((matrix.rows() != rows) || (matrix.cols() != cols))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::MPCProblemBuilder::" << functionName << "] The matrix "
+                             "has to be a " << rows << " x " << cols << " matrix.");
+        return false;
+    }
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setDynamics(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& A,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& B)
+{
+    for (int k = 0; k < m_horizon; k++)
+    {
+        if (!setStageDynamics(k, A, B))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setStageDynamics(
+    int stage,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& A,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& B)
+{
+    if (!checkStage(stage, m_horizon, "setStageDynamics")
+        || !checkSize(A, m_numberOfStates, m_numberOfStates, "setStageDynamics")
+        || !checkSize(B, m_numberOfStates, m_numberOfInputs, "setStageDynamics"))
+    {
+        return false;
+    }
+
+    // the columns of A_k and B_k are contiguous in the compressed-column arrays
+    const c_int nx = m_numberOfStates;
+    const c_int nu = m_numberOfInputs;
+    const c_int* outer = m_linearConstraints.outerIndexPtr();
+    c_float* values = m_linearConstraints.valuePtr();
+    for (c_int j = 0; j < nx; j++)
+    {
+        Eigen::Map<Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(values + outer[stage * nx + j] + 1,
+                                                              nx)
+            = A.col(j);
+    }
+    const c_int firstInputColumn = nx * (m_horizon + 1) + stage * nu;
+    for (c_int j = 0; j < nu; j++)
+    {
+        Eigen::Map<Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(values + outer[firstInputColumn + j],
+                                                              nx)
+            = B.col(j);
+    }
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setWeights(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& Q,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& R)
+{
+    if (!checkSize(Q, m_numberOfStates, m_numberOfStates, "setWeights")
+        || !checkSize(R, m_numberOfInputs, m_numberOfInputs, "setWeights"))
+    {
+        return false;
+    }
+
+    for (int k = 0; k < m_horizon + 1; k++)
+    {
+        setStageStateWeight(k, Q);
+    }
+    for (int k = 0; k < m_horizon; k++)
+    {
+        setStageInputWeight(k, R);
+    }
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setStageStateWeight(
+    int stage, const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& Q)
+{
+    if (!checkStage(stage, m_horizon + 1, "setStageStateWeight")
+        || !checkSize(Q, m_numberOfStates, m_numberOfStates, "setStageStateWeight"))
+    {
+        return false;
+    }
+
+    setHessianBlock(static_cast<c_int>(stage) * m_numberOfStates, Q);
+    updateStageGradient(stage);
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setStageInputWeight(
+    int stage, const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, Eigen::Dynamic>>& R)
+{
+    if (!checkStage(stage, m_horizon, "setStageInputWeight")
+        || !checkSize(R, m_numberOfInputs, m_numberOfInputs, "setStageInputWeight"))
+    {
+        return false;
+    }
+
+    setHessianBlock(static_cast<c_int>(m_numberOfStates) * (m_horizon + 1)
+                        + static_cast<c_int>(stage) * m_numberOfInputs,
+                    R);
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setStateBounds(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& stateMin,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& stateMax)
+{
+    if (!checkSize(stateMin, m_numberOfStates, 1, "setStateBounds")
+        || !checkSize(stateMax, m_numberOfStates, 1, "setStateBounds"))
+    {
+        return false;
+    }
+
+    const int offset = m_numberOfStates * (m_horizon + 1);
+    for (int k = 0; k < m_horizon + 1; k++)
+    {
+        m_lowerBound.segment(offset + k * m_numberOfStates, m_numberOfStates) = stateMin;
+        m_upperBound.segment(offset + k * m_numberOfStates, m_numberOfStates) = stateMax;
+    }
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setInputBounds(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& inputMin,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& inputMax)
+{
+    if (!checkSize(inputMin, m_numberOfInputs, 1, "setInputBounds")
+        || !checkSize(inputMax, m_numberOfInputs, 1, "setInputBounds"))
+    {
+        return false;
+    }
+
+    const int offset = 2 * m_numberOfStates * (m_horizon + 1);
+    for (int k = 0; k < m_horizon; k++)
+    {
+        m_lowerBound.segment(offset + k * m_numberOfInputs, m_numberOfInputs) = inputMin;
+        m_upperBound.segment(offset + k * m_numberOfInputs, m_numberOfInputs) = inputMax;
+    }
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setInitialState(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& initialState)
+{
+    if (!checkSize(initialState, m_numberOfStates, 1, "setInitialState"))
+    {
+        return false;
+    }
+
+    // the first constraint is -x_0 = -initialState
+    m_lowerBound.head(m_numberOfStates) = -initialState;
+    m_upperBound.head(m_numberOfStates) = -initialState;
+    return true;
+}
+
+bool OsqpEigen::MPCProblemBuilder::setStateReference(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& stateReference)
+{
+    if (!checkSize(stateReference, m_numberOfStates, 1, "setStateReference"))
+    {
+        return false;
+    }
+
+    m_stateReference = stateReference;
+    for (int k = 0; k < m_horizon + 1; k++)
+    {
+        updateStageGradient(k);
+    }
+    return true;
+}
+
+const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>&
+OsqpEigen::MPCProblemBuilder::getHessianMatrix() const
+{
+    return m_hessian;
+}
+
+const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>&
+OsqpEigen::MPCProblemBuilder::getLinearConstraintsMatrix() const
+{
+    return m_linearConstraints;
+}
+
+Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>
+OsqpEigen::MPCProblemBuilder::getHessianValues() const
+{
+    return Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(m_hessian.valuePtr(),
+                                                                       m_hessian.nonZeros());
+}
+
+Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>
+OsqpEigen::MPCProblemBuilder::getLinearConstraintsValues() const
+{
+    return Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(
+        m_linearConstraints.valuePtr(), m_linearConstraints.nonZeros());
+}
+
+const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& OsqpEigen::MPCProblemBuilder::getGradient() const
+{
+    return m_gradient;
+}
+
+const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& OsqpEigen::MPCProblemBuilder::getLowerBound() const
+{
+    return m_lowerBound;
+}
+
+const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& OsqpEigen::MPCProblemBuilder::getUpperBound() const
+{
+    return m_upperBound;
+}
+
+std::vector<OsqpEigen::StageBlock> OsqpEigen::MPCProblemBuilder::getPrimalStageBlocks() const
+{
+    const c_int horizon = m_horizon;
+    return {{horizon + 1, m_numberOfStates}, {horizon, m_numberOfInputs}};
+}
+
+std::vector<OsqpEigen::StageBlock> OsqpEigen::MPCProblemBuilder::getDualStageBlocks() const
+{
+    const c_int horizon = m_horizon;
+    return {{horizon + 1, m_numberOfStates},
+            {horizon + 1, m_numberOfStates},
+            {horizon, m_numberOfInputs}};
+}
+
+bool OsqpEigen::MPCProblemBuilder::setSolverData(OsqpEigen::Data& data)
+{
+    data.setNumberOfVariables(getNumberOfVariables());
+    data.setNumberOfConstraints(getNumberOfConstraints());
+
+    if (!data.borrowHessianMatrix(m_hessian))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::MPCProblemBuilder::setSolverData] Unable to set the "
+                             "hessian matrix.");
+        return false;
+    }
+
+    if (!data.borrowLinearConstraintsMatrix(m_linearConstraints))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::MPCProblemBuilder::setSolverData] Unable to set the "
+                             "linear constraints matrix.");
+        return false;
+    }
+
+    if (!data.setGradient(m_gradient) || !data.setBounds(m_lowerBound, m_upperBound))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::MPCProblemBuilder::setSolverData] Unable to set the "
+                             "gradient and the bounds.");
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,329 @@
+/**
+ * @file PortfolioSolver.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Std
+#include <algorithm>
+
+// OsqpEigen
+#include <OsqpEigen/Logging.hpp>
+#include <OsqpEigen/PortfolioSolver.hpp>
+
+OsqpEigen::PortfolioSolver::PortfolioSolver()
+    : m_isSolverInitialized(false)
+    , m_isSolved(false)
+    , m_winner(-1)
+{
+    m_data = std::make_unique<OsqpEigen::Data>();
+}
+
+const std::unique_ptr<OsqpEigen::Settings>& OsqpEigen::PortfolioSolver::addProfile()
+{
+    m_settings.push_back(std::make_unique<OsqpEigen::Settings>());
+    return m_settings.back();
+}
+
+int OsqpEigen::PortfolioSolver::getNumberOfProfiles() const
+{
+    return static_cast<int>(m_settings.size());
+}
+
+bool OsqpEigen::PortfolioSolver::initSolver(int numberOfThreads)
+{
+    if (m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::initSolver] The solver has been "
+                             "already initialized. Please use clearSolver() method to deallocate "
+                             "memory.");
+        return false;
+    }
+
+    if (m_settings.empty())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::initSolver] No settings profile has "
+                             "been added. Please call addProfile() method.");
+        return false;
+    }
+
+    if (!m_data->isSet())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::initSolver] Some data are not set.");
+        return false;
+    }
+
+    const OSQPData* data = m_data->getData();
+    const c_int n = data->n;
+    const c_int m = data->m;
+    const int numberOfProfiles = getNumberOfProfiles();
+
+    // the matrices are copied directly from the compressed-column arrays stored in Data, the
+    // hessian contains only the upper triangular part
+    const Eigen::Map<const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>>
+        hessian(n, n, data->P->p[n], data->P->p, data->P->i, data->P->x);
+
+    // all the profiles share the vectors, their address does not change until the solver is
+    // cleared
+    m_gradient = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(data->q, n);
+    if (m > 0)
+    {
+        m_lowerBound = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(data->l, m);
+        m_upperBound = Eigen::Map<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(data->u, m);
+    } else
+    {
+        m_lowerBound.resize(0);
+        m_upperBound.resize(0);
+    }
+
+    m_solvers.clear();
+    m_solvers.reserve(numberOfProfiles);
+    for (int k = 0; k < numberOfProfiles; k++)
+    {
+        auto solver = std::make_unique<OsqpEigen::Solver>();
+        *(solver->settings()->getSettings()) = *(m_settings[k]->getSettings());
+
+        solver->data()->setNumberOfVariables(static_cast<int>(n));
+        solver->data()->setNumberOfConstraints(static_cast<int>(m));
+        bool ok = solver->data()->setHessianMatrix(hessian, true);
+        ok = ok && solver->data()->setGradient(m_gradient);
+        if (m > 0)
+        {
+            const Eigen::Map<const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>>
+                linearConstraints(m, n, data->A->p[n], data->A->p, data->A->i, data->A->x);
+            ok = ok && solver->data()->setLinearConstraintsMatrix(linearConstraints);
+            ok = ok && solver->data()->setBounds(m_lowerBound, m_upperBound);
+        }
+
+        if (!ok)
+        {
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::initSolver] Unable to set the data "
+                                 "of the profile " << k << ".");
+            m_solvers.clear();
+            return false;
+        }
+
+        m_solvers.push_back(std::move(solver));
+    }
+
+    // the profiles race each other, hence by default each one has its own thread. The calling
+    // thread solves a profile as well
+    if (numberOfThreads <= 0)
+    {
+        numberOfThreads = numberOfProfiles;
+    }
+    numberOfThreads = std::min(numberOfThreads, numberOfProfiles);
+    m_threadPool = std::make_unique<OsqpEigen::ThreadPool>(numberOfThreads - 1);
+
+    std::vector<char> isInitialized(numberOfProfiles, false);
+    m_threadPool->parallelFor(numberOfProfiles, [&](std::size_t k) {
+        isInitialized[k] = m_solvers[k]->initSolver();
+    });
+
+    if (std::find(isInitialized.begin(), isInitialized.end(), false) != isInitialized.end())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::initSolver] Unable to initialize the "
+                             "solver of all the profiles.");
+        m_solvers.clear();
+        m_threadPool.reset();
+        return false;
+    }
+
+    m_solution.setZero(n);
+    m_dualSolution.setZero(m);
+    m_errorExitFlags.assign(numberOfProfiles, OsqpEigen::ErrorExitFlag::NoError);
+    m_status.assign(numberOfProfiles, OsqpEigen::Status::Unsolved);
+    m_winner = -1;
+
+    m_pendingUpdates.assign(numberOfProfiles, PendingUpdates());
+
+    m_isSolverInitialized = true;
+    return true;
+}
+
+bool OsqpEigen::PortfolioSolver::isInitialized() const
+{
+    return m_isSolverInitialized;
+}
+
+void OsqpEigen::PortfolioSolver::clearSolver()
+{
+    if (m_isSolverInitialized)
+    {
+        m_solvers.clear();
+        m_threadPool.reset();
+        m_isSolverInitialized = false;
+    }
+}
+
+bool OsqpEigen::PortfolioSolver::updateGradient(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& gradient)
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::updateGradient] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    if (gradient.rows() != m_gradient.rows())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::updateGradient] The size of the "
+                             "gradient must be equal to the number of the variables.");
+        return false;
+    }
+
+    m_gradient = gradient;
+    for (auto& pendingUpdates : m_pendingUpdates)
+    {
+        pendingUpdates.isGradientToUpdate = true;
+    }
+    return true;
+}
+
+bool OsqpEigen::PortfolioSolver::updateBounds(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound,
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound)
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::updateBounds] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    if ((lowerBound.rows() != m_lowerBound.rows()) || (upperBound.rows() != m_upperBound.rows()))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::updateBounds] The size of the bounds "
+                             "must be equal to the number of the constraints.");
+        return false;
+    }
+
+    m_lowerBound = lowerBound;
+    m_upperBound = upperBound;
+    for (auto& pendingUpdates : m_pendingUpdates)
+    {
+        pendingUpdates.areBoundsToUpdate = (m_lowerBound.rows() > 0);
+    }
+    return true;
+}
+
+OsqpEigen::ErrorExitFlag OsqpEigen::PortfolioSolver::solveProblem()
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::solveProblem] The solver has not been "
+                             "initialized yet. Please call initSolver() method.");
+        return OsqpEigen::ErrorExitFlag::WorkspaceNotInitError;
+    }
+
+    m_isSolved = false;
+    m_winner = -1;
+
+    // the new data are sent by the thread solving the profile. A pending update is cleared only
+    // if it is sent, hence the data of a profile that failed are sent again by the next call
+    m_threadPool->parallelFor(m_solvers.size(), [this](std::size_t k) {
+        OsqpEigen::Solver& solver = *m_solvers[k];
+        PendingUpdates& pendingUpdates = m_pendingUpdates[k];
+
+        if (pendingUpdates.isGradientToUpdate)
+        {
+            pendingUpdates.isGradientToUpdate = !solver.updateGradient(m_gradient);
+        }
+        if (pendingUpdates.areBoundsToUpdate)
+        {
+            pendingUpdates.areBoundsToUpdate = !solver.updateBounds(m_lowerBound, m_upperBound);
+        }
+
+        const bool isDataUpdated
+            = !pendingUpdates.isGradientToUpdate && !pendingUpdates.areBoundsToUpdate;
+        if (!isDataUpdated)
+        {
+            m_errorExitFlags[k] = OsqpEigen::ErrorExitFlag::DataValidationError;
+            m_status[k] = OsqpEigen::Status::Unsolved;
+            return;
+        }
+
+        m_errorExitFlags[k] = solver.solveProblem(m_isSolved);
+        m_status[k] = (m_errorExitFlags[k] == OsqpEigen::ErrorExitFlag::NoError)
+                          ? solver.getStatus()
+                          : OsqpEigen::Status::Unsolved;
+        if (m_status[k] != OsqpEigen::Status::Solved)
+        {
+            return;
+        }
+
+        // only the first profile reaching the solution stores it, the others are cancelled
+        int noWinner = -1;
+        if (m_winner.compare_exchange_strong(noWinner, static_cast<int>(k)))
+        {
+            m_isSolved = true;
+            m_solution = solver.solutionView();
+            m_dualSolution = solver.dualSolutionView();
+        }
+    });
+
+    if (m_winner >= 0)
+    {
+        return OsqpEigen::ErrorExitFlag::NoError;
+    }
+
+    // no profile solved the problem, the result of the first profile is reported
+    if (m_errorExitFlags.front() != OsqpEigen::ErrorExitFlag::NoError)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::PortfolioSolver::solveProblem] Unable to solve the "
+                             "problem.");
+        return m_errorExitFlags.front();
+    }
+
+    m_solution = m_solvers.front()->solutionView();
+    m_dualSolution = m_solvers.front()->dualSolutionView();
+    return OsqpEigen::ErrorExitFlag::NoError;
+}
+
+int OsqpEigen::PortfolioSolver::getWinner() const
+{
+    return m_winner;
+}
+
+OsqpEigen::Status OsqpEigen::PortfolioSolver::getStatus() const
+{
+    if (m_status.empty())
+    {
+        return OsqpEigen::Status::Unsolved;
+    }
+
+    return (m_winner >= 0) ? m_status[m_winner] : m_status.front();
+}
+
+const std::vector<OsqpEigen::ErrorExitFlag>& OsqpEigen::PortfolioSolver::getErrorExitFlags() const
+{
+    return m_errorExitFlags;
+}
+
+const std::vector<OsqpEigen::Status>& OsqpEigen::PortfolioSolver::getProfilesStatus() const
+{
+    return m_status;
+}
+
+const Eigen::Matrix<c_float, Eigen::Dynamic, 1>& OsqpEigen::PortfolioSolver::getSolution() const
+{
+    return m_solution;
+}
+
+const Eigen::Matrix<c_float, Eigen::Dynamic, 1>&
+OsqpEigen::PortfolioSolver::getDualSolution() const
+{
+    return m_dualSolution;
+}
+
+const std::unique_ptr<OsqpEigen::Settings>&
+OsqpEigen::PortfolioSolver::settings(int profile) const
+{
+    return m_settings[profile];
+}
+
+const std::unique_ptr<OsqpEigen::Data>& OsqpEigen::PortfolioSolver::data() const
+{
+    return m_data;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file RealTime.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Std
+#include <atomic>
+#include <cstdlib>
+
+// OsqpEigen
+#include <OsqpEigen/RealTime.hpp>
+
+namespace
+{
+// the counters are plain thread local integers, hence they are accessed without allocating
+thread_local std::size_t hotPathDepth = 0;
+thread_local std::size_t allocationCount = 0;
+std::atomic<bool> isAbortOnAllocationEnabled{false};
+} // namespace
+
+bool OsqpEigen::RealTime::isAllocationTrackingEnabled()
+{
+#ifdef OSQP_EIGEN_REAL_TIME_CHECKS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::size_t OsqpEigen::RealTime::getAllocationCount()
+{
+    return allocationCount;
+}
+
+void OsqpEigen::RealTime::resetAllocationCount()
+{
+    allocationCount = 0;
+}
+
+void OsqpEigen::RealTime::setAbortOnAllocation(bool abortOnAllocation)
+{
+    isAbortOnAllocationEnabled = abortOnAllocation;
+}
+
+void OsqpEigen::RealTime::recordAllocation()
+{
+    if (hotPathDepth > 0)
+    {
+        allocationCount++;
+        if (isAbortOnAllocationEnabled)
+        {
+            std::abort();
+        }
+    }
+}
+
+OsqpEigen::RealTime::HotPathScope::HotPathScope()
+{
+    hotPathDepth++;
+}
+
+OsqpEigen::RealTime::HotPathScope::~HotPathScope()
+{
+    hotPathDepth--;
+}
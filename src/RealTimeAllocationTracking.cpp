@@ -0,0 +1,259 @@
+/**
+ * @file RealTimeAllocationTracking.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// This file is not part of the OsqpEigen library. It is compiled in the OsqpEigenRealTimeChecks
+// object library, which is linked only by the executables that check the real time behavior of
+// the library, since the replacement of the global operators affects the whole program.
+// With glibc the malloc family is replaced too, so that the buffers of Eigen and the memory
+// allocated by OSQP are tracked. The replaced functions forward to the glibc allocator.
+
+#ifdef OSQP_EIGEN_REAL_TIME_CHECKS
+
+// Std
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#ifdef __GLIBC__
+#include <cerrno>
+#define OSQP_EIGEN_REAL_TIME_TRACK_MALLOC
+#endif
+
+// OsqpEigen
+#include <OsqpEigen/RealTime.hpp>
+
+#ifdef OSQP_EIGEN_REAL_TIME_TRACK_MALLOC
+
+// glibc exports its allocator also with these names
+extern "C"
+{
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(std::size_t size) noexcept
+{
+    OsqpEigen::RealTime::recordAllocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) noexcept
+{
+    OsqpEigen::RealTime::recordAllocation();
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept
+{
+    OsqpEigen::RealTime::recordAllocation();
+    return __libc_realloc(ptr, size);
+}
+
+void* memalign(std::size_t alignment, std::size_t size) noexcept
+{
+    OsqpEigen::RealTime::recordAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+{
+    OsqpEigen::RealTime::recordAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept
+{
+    OsqpEigen::RealTime::recordAllocation();
+
+    // the alignment has to be a power of two multiple of sizeof(void*)
+    if ((alignment == 0) || (alignment % sizeof(void*) != 0)
+        || ((alignment & (alignment - 1)) != 0))
+    {
+        return EINVAL;
+    }
+
+    void* alignedPtr = __libc_memalign(alignment, size);
+    if (alignedPtr == nullptr)
+    {
+        return ENOMEM;
+    }
+    *ptr = alignedPtr;
+    return 0;
+}
+
+void free(void* ptr) noexcept
+{
+    __libc_free(ptr);
+}
+}
+
+#endif
+
+namespace
+{
+void* trackedAllocation(std::size_t size)
+{
+    // if the malloc family is replaced the allocation is counted by std::malloc
+#ifndef OSQP_EIGEN_REAL_TIME_TRACK_MALLOC
+    OsqpEigen::RealTime::recordAllocation();
+#endif
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+#ifdef __cpp_aligned_new
+void* trackedAlignedAllocation(std::size_t size, std::align_val_t alignment)
+{
+#ifndef OSQP_EIGEN_REAL_TIME_TRACK_MALLOC
+    OsqpEigen::RealTime::recordAllocation();
+#endif
+
+    const std::size_t alignmentValue = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    void* ptr = _aligned_malloc(size == 0 ? 1 : size, alignmentValue);
+#else
+    // the size passed to aligned_alloc has to be a multiple of the alignment
+    const std::size_t alignedSize
+        = ((size + alignmentValue - 1) / alignmentValue) * alignmentValue;
+    void* ptr = std::aligned_alloc(alignmentValue, alignedSize == 0 ? alignmentValue : alignedSize);
+#endif
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void alignedDeallocation(void* ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+#endif
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return trackedAllocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return trackedAllocation(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return trackedAllocation(size);
+    } catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return trackedAllocation(size);
+    } catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#ifdef __cpp_aligned_new
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return trackedAlignedAllocation(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return trackedAlignedAllocation(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return trackedAlignedAllocation(size, alignment);
+    } catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return trackedAlignedAllocation(size, alignment);
+    } catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    alignedDeallocation(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    alignedDeallocation(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    alignedDeallocation(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    alignedDeallocation(ptr);
+}
+
+#endif
+
+#endif
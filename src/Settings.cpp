@@ -6,7 +6,7 @@
  */
 
 #include <OsqpEigen/Compat.hpp>
-#include <OsqpEigen/Debug.hpp>
+#include <OsqpEigen/Logging.hpp>
 #include <OsqpEigen/Settings.hpp>
 #include <iostream>
 
@@ -49,7 +49,8 @@ void OsqpEigen::Settings::setAdaptiveRho(const bool isRhoStepSizeAdactive)
 #if (EMBEDDED != 1) && (OSQP_EMBEDDED_MODE != 1)
     m_settings->adaptive_rho = (c_int)isRhoStepSizeAdactive;
 #else
-    debugStream() << "[OsqpEigen::Settings::setAdaptiveRho] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setAdaptiveRho] OSPQ has been set to EMBEDDED, "
+                           "hence this setting is disabled.");
     unused(isRhoStepSizeAdactive);
 #endif
 }
@@ -59,7 +60,8 @@ void OsqpEigen::Settings::setAdaptiveRhoInterval(const int rhoInterval)
 #if (EMBEDDED != 1) && (OSQP_EMBEDDED_MODE != 1)
     m_settings->adaptive_rho_interval = (c_int)rhoInterval;
 #else
-    debugStream() << "[OsqpEigen::Settings::setAdaptiveRhoInterval] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setAdaptiveRhoInterval] OSPQ has been set to "
+                           "EMBEDDED, hence this setting is disabled.");
     unused(rhoInterval);
 #endif
 }
@@ -69,7 +71,8 @@ void OsqpEigen::Settings::setAdaptiveRhoTolerance(const double adaptiveRhoTolera
 #if (EMBEDDED != 1) && (OSQP_EMBEDDED_MODE != 1)
     m_settings->adaptive_rho_tolerance = (c_float)adaptiveRhoTolerance;
 #else
-    debugStream() << "[OsqpEigen::Settings::setAdaptiveRhoTolerance] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setAdaptiveRhoTolerance] OSPQ has been set to "
+                           "EMBEDDED, hence this setting is disabled.");
     unused(adaptiveRhoTolerance);
 #endif
 }
@@ -80,11 +83,13 @@ void OsqpEigen::Settings::setAdaptiveRhoFraction(const double adaptiveRhoFractio
 #if defined(PROFILING) || defined(OSQP_ENABLE_PROFILING)
     m_settings->adaptive_rho_fraction = (c_float)adaptiveRhoFraction;
 #else
-    debugStream() << "[OsqpEigen::Settings::setAdaptiveRhoFraction] OSPQ has been set without PROFILING, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setAdaptiveRhoFraction] OSPQ has been set "
+                           "without PROFILING, hence this setting is disabled.");
     unused(adaptiveRhoFraction);
 #endif // ifdef PROFILING
 #else  // # if EMBEDDED != 1
-    debugStream() << "[OsqpEigen::Settings::setAdaptiveRhoFraction] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setAdaptiveRhoFraction] OSPQ has been set to "
+                           "EMBEDDED, hence this setting is disabled.");
     unused(adaptiveRhoFraction);
 #endif // # if EMBEDDED != 1
 }
@@ -148,7 +153,8 @@ void OsqpEigen::Settings::setDelta(const double delta)
 #if !defined(EMBEDDED) && !defined(OSQP_EMBEDDED_MODE)
     m_settings->delta = (c_float)delta;
 #else
-    debugStream() << "[OsqpEigen::Settings::setDelta] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setDelta] OSPQ has been set to EMBEDDED, hence "
+                           "this setting is disabled.");
     unused(delta);
 #endif
 }
@@ -162,7 +168,8 @@ void OsqpEigen::Settings::setPolish(const bool polish)
     m_settings->polish = (c_int)polish;
 #endif
 #else
-    debugStream() << "[OsqpEigen::Settings::setPolish] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setPolish] OSPQ has been set to EMBEDDED, hence "
+                           "this setting is disabled.");
     unused(polish);
 #endif
 }
@@ -172,7 +179,8 @@ void OsqpEigen::Settings::setPolishRefineIter(const int polishRefineIter)
 #if !defined(EMBEDDED) && !defined(OSQP_EMBEDDED_MODE)
     m_settings->polish_refine_iter = (c_int)polishRefineIter;
 #else
-    debugStream() << "[OsqpEigen::Settings::setPolishRefineIter] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setPolishRefineIter] OSPQ has been set to "
+                           "EMBEDDED, hence this setting is disabled.");
     unused(polishRefineIter);
 #endif
 }
@@ -182,7 +190,8 @@ void OsqpEigen::Settings::setVerbosity(const bool isVerbose)
 #if !defined(EMBEDDED) && !defined(OSQP_EMBEDDED_MODE)
     m_settings->verbose = (c_int)isVerbose;
 #else
-    debugStream() << "[OsqpEigen::Settings::setVerbosity] OSPQ has been set to EMBEDDED, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setVerbosity] OSPQ has been set to EMBEDDED, "
+                           "hence this setting is disabled.");
     unused(isVerbose);
 #endif
 }
@@ -202,7 +211,8 @@ void OsqpEigen::Settings::setCheckDualGap(const bool checkDualGap)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->check_dualgap = (c_int)checkDualGap;
 #else
-    debugStream() << "[OsqpEigen::Settings::setCheckDualGap] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setCheckDualGap] OSQP version is lower than "
+                           "v1.0.0, this setting is not available.");
     unused(checkDualGap);
 #endif
 }
@@ -221,7 +231,8 @@ void OsqpEigen::Settings::setTimeLimit(const double timeLimit)
 #if defined(PROFILING) || defined(OSQP_ENABLE_PROFILING)
     m_settings->time_limit = (c_float)timeLimit;
 #else
-    debugStream() << "[OsqpEigen::Settings::setTimeLimit] OSPQ has been set without PROFILING, hence this setting is disabled." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setTimeLimit] OSPQ has been set without "
+                           "PROFILING, hence this setting is disabled.");
     unused(timeLimit);
 #endif
 }
@@ -231,7 +242,8 @@ void OsqpEigen::Settings::setAllocateSolution(const bool allocateSolution)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->allocate_solution = static_cast<decltype(m_settings->allocate_solution)>(allocateSolution);
 #else
-    debugStream() << "[OsqpEigen::Settings::setAllocateSolution] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setAllocateSolution] OSQP version is lower than "
+                           "v1.0.0, this setting is not available.");
     unused(allocateSolution);
 #endif
 }
@@ -241,7 +253,8 @@ void OsqpEigen::Settings::setCgMaxIter(const int cgMaxIter)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->cg_max_iter = static_cast<decltype(m_settings->cg_max_iter)>(cgMaxIter);
 #else
-    debugStream() << "[OsqpEigen::Settings::setCgMaxIter] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setCgMaxIter] OSQP version is lower than v1.0.0, "
+                           "this setting is not available.");
     unused(cgMaxIter);
 #endif
 }
@@ -251,7 +264,8 @@ void OsqpEigen::Settings::setCgPrecond(const int cgPrecond)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->cg_precond = static_cast<decltype(m_settings->cg_precond)>(cgPrecond);
 #else
-    debugStream() << "[OsqpEigen::Settings::setCgPrecond] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setCgPrecond] OSQP version is lower than v1.0.0, "
+                           "this setting is not available.");
     unused(cgPrecond);
 #endif
 }
@@ -261,7 +275,8 @@ void OsqpEigen::Settings::setCgTolFraction(const double cgTolFraction)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->cg_tol_fraction = static_cast<decltype(m_settings->cg_tol_fraction)>(cgTolFraction);
 #else
-    debugStream() << "[OsqpEigen::Settings::setCgTolFraction] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setCgTolFraction] OSQP version is lower than "
+                           "v1.0.0, this setting is not available.");
     unused(cgTolFraction);
 #endif
 }
@@ -271,7 +286,8 @@ void OsqpEigen::Settings::setCgTolReduction(const double cgTolReduction)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->cg_tol_reduction = static_cast<decltype(m_settings->cg_tol_reduction)>(cgTolReduction);
 #else
-    debugStream() << "[OsqpEigen::Settings::setCgTolReduction] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setCgTolReduction] OSQP version is lower than "
+                           "v1.0.0, this setting is not available.");
     unused(cgTolReduction);
 #endif
 }
@@ -281,7 +297,8 @@ void OsqpEigen::Settings::setDevice(const int device)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->device = static_cast<decltype(m_settings->device)>(device);
 #else
-    debugStream() << "[OsqpEigen::Settings::setDevice] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setDevice] OSQP version is lower than v1.0.0, "
+                           "this setting is not available.");
     unused(device);
 #endif
 }
@@ -291,7 +308,8 @@ void OsqpEigen::Settings::setProfilerLevel(const int level)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->profiler_level = static_cast<decltype(m_settings->profiler_level)>(level);
 #else
-    debugStream() << "[OsqpEigen::Settings::setProfilerLevel] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setProfilerLevel] OSQP version is lower than "
+                           "v1.0.0, this setting is not available.");
     unused(level);
 #endif
 }
@@ -301,7 +319,8 @@ void OsqpEigen::Settings::setRhoIsVec(const bool rhoIsVec)
 #ifdef OSQP_EIGEN_OSQP_IS_V1_FINAL
     m_settings->rho_is_vec = static_cast<decltype(m_settings->rho_is_vec)>(rhoIsVec);
 #else
-    debugStream() << "[OsqpEigen::Settings::setRhoIsVec] OSQP version is lower than v1.0.0, this setting is not available." << std::endl;
+    OSQP_EIGEN_LOG_WARNING("[OsqpEigen::Settings::setRhoIsVec] OSQP version is lower than v1.0.0, "
+                           "this setting is not available.");
     unused(rhoIsVec);
 #endif
 }
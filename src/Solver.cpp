@@ -5,12 +5,133 @@
  * @date 2018
  */
 
+// Std
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <utility>
+#include <vector>
+
 // OsqpEigen
 #include <OsqpEigen/Data.hpp>
-#include <OsqpEigen/Debug.hpp>
+#include <OsqpEigen/Logging.hpp>
 #include <OsqpEigen/Settings.hpp>
 #include <OsqpEigen/Solver.hpp>
 
+namespace
+{
+bool isStageBlocksSizeValid(const std::vector<OsqpEigen::StageBlock>& blocks, c_int size)
+{
+    c_int blocksSize = 0;
+    for (const auto& block : blocks)
+    {
+        if ((block.numberOfStages < 0) || (block.stageSize <= 0))
+        {
+            return false;
+        }
+        blocksSize += block.numberOfStages * block.stageSize;
+    }
+    return blocksSize == size;
+}
+
+// number of iterations of a chunk of a cancellable solve, if the termination checks and the rho
+// updates are more frequent
+constexpr c_int minimumIterationsPerChunk = 25;
+
+// interval of the rho updates used by osqp without profiling when adaptive_rho_interval is zero
+constexpr c_int adaptiveRhoMultipleTermination = 4;
+constexpr c_int adaptiveRhoFixedInterval = 100;
+
+c_int greatestCommonDivisor(c_int a, c_int b)
+{
+    while (b != 0)
+    {
+        const c_int remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+c_int iterationsPerChunk(const OSQPSettings& settings)
+{
+    // the iteration counter of osqp restarts from one in each chunk, hence a chunk has to be a
+    // multiple of both the termination check and the rho update intervals
+    c_int iterations = settings.check_termination > 0 ? settings.check_termination : 1;
+    if (settings.adaptive_rho && (settings.adaptive_rho_interval > 0))
+    {
+        iterations = iterations / greatestCommonDivisor(iterations, settings.adaptive_rho_interval)
+                     * settings.adaptive_rho_interval;
+    }
+
+    // the cost of starting a chunk is amortized over a minimum number of iterations
+    const c_int numberOfIntervals = (minimumIterationsPerChunk + iterations - 1) / iterations;
+    return iterations * numberOfIntervals;
+}
+
+// the approximate solutions are evaluated when the last iteration of a chunk is reached, hence
+// the next chunk may still find an accurate one
+bool isChunkInterrupted(c_int status)
+{
+    return (status == OSQP_MAX_ITER_REACHED) || (status == OSQP_SOLVED_INACCURATE)
+           || (status == OSQP_PRIMAL_INFEASIBLE_INACCURATE)
+           || (status == OSQP_DUAL_INFEASIBLE_INACCURATE);
+}
+
+// the solution of these statuses contains the last iterate instead of a certificate
+bool hasIterate(c_int status)
+{
+    return (status == OSQP_MAX_ITER_REACHED) || (status == OSQP_SOLVED_INACCURATE)
+           || (status == OSQP_TIME_LIMIT_REACHED) || (status == OSQP_SIGINT);
+}
+
+c_float& primalResidual(OSQPInfo& info)
+{
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    return info.prim_res;
+#else
+    return info.pri_res;
+#endif
+}
+
+c_float& dualResidual(OSQPInfo& info)
+{
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    return info.dual_res;
+#else
+    return info.dua_res;
+#endif
+}
+
+c_float largestResidual(OSQPInfo& info)
+{
+    return std::max(primalResidual(info), dualResidual(info));
+}
+
+void setStatus(OSQPInfo* info, c_int status, const char* statusName)
+{
+    info->status_val = status;
+    std::strncpy(info->status, statusName, sizeof(info->status) - 1);
+    info->status[sizeof(info->status) - 1] = '\0';
+}
+
+void shiftStages(c_float* vector, const std::vector<OsqpEigen::StageBlock>& blocks)
+{
+    for (const auto& block : blocks)
+    {
+        const c_int size = block.numberOfStages * block.stageSize;
+        if (block.numberOfStages > 1)
+        {
+            // the stages are moved towards the beginning, hence a forward copy is safe
+            std::copy(vector + block.stageSize, vector + size, vector);
+        }
+        vector += size;
+    }
+}
+
+} // namespace
+
 #ifdef OSQP_EIGEN_OSQP_IS_V1
 void OsqpEigen::Solver::OSQPSolverDeleter(OSQPSolver* ptr) noexcept
 #else
@@ -25,6 +146,9 @@ void OsqpEigen::Solver::OSQPWorkspaceDeleter(OSQPWorkspace* ptr) noexcept
 
 OsqpEigen::Solver::Solver()
     : m_isSolverInitialized(false)
+    , m_isSparsityPatternSuperset(false)
+    , m_isRealTimeModeEnabled(false)
+    , m_asyncWorkerCpu(-1)
     ,
 #ifdef OSQP_EIGEN_OSQP_IS_V1
     m_solver{nullptr, Solver::OSQPSolverDeleter}
@@ -40,9 +164,8 @@ bool OsqpEigen::Solver::clearSolverVariables()
 {
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::clearSolverVariables] Unable to clear the solver "
-                         "variables. "
-                      << "Are you sure that the solver is initialized?" << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::clearSolverVariables] Unable to clear the solver "
+                             "variables. Are you sure that the solver is initialized?");
         return false;
     }
 
@@ -76,6 +199,25 @@ bool OsqpEigen::Solver::clearSolverVariables()
     {
         m_workspace->xz_tilde[i] = 0;
     }
+#else
+    // the iterates are set with a zero warm start, which also enables the warm starting
+    // setting, hence the setting is restored afterwards
+    const c_int isWarmStarting = m_solver->settings->warm_starting;
+    m_primalVariables.setZero(getData()->n);
+    m_dualVariables.setZero(getData()->m);
+    const bool isWarmStarted
+        = osqp_warm_start(m_solver.get(), m_primalVariables.data(), m_dualVariables.data()) == 0;
+    m_solver->settings->warm_starting = isWarmStarting;
+    if (!isWarmStarted)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::clearSolverVariables] Unable to set to zero the "
+                             "solver iterates.");
+        return false;
+    }
+
+    // getPrimalVariable() and getDualVariable() return the solution stored in the solver
+    std::fill(m_solver->solution->x, m_solver->solution->x + getData()->n, 0);
+    std::fill(m_solver->solution->y, m_solver->solution->y + getData()->m, 0);
 #endif
 
     return true;
@@ -83,16 +225,30 @@ bool OsqpEigen::Solver::clearSolverVariables()
 
 bool OsqpEigen::Solver::initSolver()
 {
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.initialization);
+    OsqpEigen::SolverEventScope event(m_eventRingBuffer.get(),
+                                      OsqpEigen::SolverEventType::InitSolver,
+                                      this);
+
     if (m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::initSolver] The solver has been already initialized. "
-                      << "Please use clearSolver() method to deallocate memory." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::initSolver] The solver has been already "
+                             "initialized. Please use clearSolver() method to deallocate memory.");
         return false;
     }
 
     if (!m_data->isSet())
     {
-        debugStream() << "[OsqpEigen::Solver::initSolver] Some data are not set." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::initSolver] Some data are not set.");
+        return false;
+    }
+
+    // osqp reads the borrowed matrices during the setup. The check only compares a few
+    // addresses, hence it is performed in every build type
+    if (!m_data->areBorrowedMatricesValid())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::initSolver] The storage of a borrowed matrix has "
+                             "been reallocated. Please borrow the matrix again.");
         return false;
     }
 
@@ -107,10 +263,9 @@ bool OsqpEigen::Solver::initSolver()
             Eigen::SparseMatrix<c_float> A(m_data->getData()->m, m_data->getData()->n);
             if (!m_data->setLinearConstraintsMatrix(A))
             {
-                debugStream() << "[OsqpEigen::Solver::initSolver] Unable to set the empty linear "
-                                 "constraint "
-                              << "matrix in case of unconstrained optimization problem"
-                              << std::endl;
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::initSolver] Unable to set the empty "
+                                     "linear constraint matrix in case of unconstrained "
+                                     "optimization problem");
                 return false;
             }
         }
@@ -130,8 +285,7 @@ bool OsqpEigen::Solver::initSolver()
                    m_settings->getSettings())
         != 0)
     {
-        debugStream() << "[OsqpEigen::Solver::initSolver] Unable to setup the workspace."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::initSolver] Unable to setup the workspace.");
         return false;
     }
 
@@ -140,18 +294,195 @@ bool OsqpEigen::Solver::initSolver()
     OSQPWorkspace* workspace;
     if (osqp_setup(&workspace, m_data->getData(), m_settings->getSettings()) != 0)
     {
-        debugStream() << "[OsqpEigen::Solver::initSolver] Unable to setup the workspace."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::initSolver] Unable to setup the workspace.");
         return false;
     }
 
     m_workspace.reset(workspace);
 #endif
 
+    OSQP_EIGEN_STATS_UPDATE(collectOsqpInfoStats(false));
+
+    cacheHessianMatrix();
+    cacheLinearConstraintsMatrix();
+
+    if (m_isRealTimeModeEnabled)
+    {
+        reserveScratchMemory();
+    }
+
     m_isSolverInitialized = true;
+    event.setExitFlag(0);
+    return true;
+}
+
+void OsqpEigen::Solver::cacheHessianMatrix()
+{
+    // the data stored in the Data object are never scaled by osqp, hence they can be used to
+    // evaluate the values that has to be updated
+    const csc* hessian = m_data->getData()->P;
+    const c_int numberOfNonZeroCoeff = hessian->p[hessian->n];
+
+    m_hessianOuterIndex.assign(hessian->p, hessian->p + hessian->n + 1);
+    m_hessianInnerIndex.assign(hessian->i, hessian->i + numberOfNonZeroCoeff);
+    m_hessianValues.assign(hessian->x, hessian->x + numberOfNonZeroCoeff);
+
+    // the vectors containing the new values can not be longer than the number of non zeros
+    m_hessianNewIndices.reserve(numberOfNonZeroCoeff);
+    m_hessianNewValues.reserve(numberOfNonZeroCoeff);
+}
+
+void OsqpEigen::Solver::cacheLinearConstraintsMatrix()
+{
+    const csc* linearConstraints = m_data->getData()->A;
+    const c_int numberOfNonZeroCoeff = linearConstraints->p[linearConstraints->n];
+
+    m_constraintsOuterIndex.assign(linearConstraints->p,
+                                   linearConstraints->p + linearConstraints->n + 1);
+    m_constraintsInnerIndex.assign(linearConstraints->i,
+                                   linearConstraints->i + numberOfNonZeroCoeff);
+    m_constraintsValues.assign(linearConstraints->x, linearConstraints->x + numberOfNonZeroCoeff);
+
+    m_constraintsNewIndices.reserve(numberOfNonZeroCoeff);
+    m_constraintsNewValues.reserve(numberOfNonZeroCoeff);
+}
+
+void OsqpEigen::Solver::getSolverVectors(
+    Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> gradient,
+    Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> lowerBound,
+    Eigen::Ref<Eigen::Matrix<c_float, Eigen::Dynamic, 1>> upperBound) const
+{
+    using Vector = Eigen::Matrix<c_float, Eigen::Dynamic, 1>;
+
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    const OSQPData* data = m_data->getData();
+    gradient = Eigen::Map<const Vector>(data->q, data->n);
+
+    // the bounds are not set if there are no constraints
+    if (data->m > 0)
+    {
+        lowerBound = Eigen::Map<const Vector>(data->l, data->m);
+        upperBound = Eigen::Map<const Vector>(data->u, data->m);
+    }
+#else
+    // osqp stores the scaled vectors, i.e. c * D * q, E * l and E * u
+    const OSQPData* data = m_workspace->data;
+    const OSQPScaling* scaling = m_workspace->scaling;
+    gradient = Eigen::Map<const Vector>(data->q, data->n);
+    lowerBound = Eigen::Map<const Vector>(data->l, data->m);
+    upperBound = Eigen::Map<const Vector>(data->u, data->m);
+    if (scaling != nullptr)
+    {
+        gradient.array()
+            *= scaling->cinv * Eigen::Map<const Vector>(scaling->Dinv, data->n).array();
+        lowerBound.array() *= Eigen::Map<const Vector>(scaling->Einv, data->m).array();
+        upperBound.array() *= Eigen::Map<const Vector>(scaling->Einv, data->m).array();
+    }
+#endif
+}
+
+bool OsqpEigen::Solver::cachedMatrixToTriplets(
+    const c_int rows,
+    const std::vector<c_int>& outerIndex,
+    const std::vector<c_int>& innerIndex,
+    const std::vector<c_float>& values,
+    std::vector<Eigen::Triplet<c_float>>& triplets) const
+{
+    // an empty matrix has no triplets
+    if (values.empty())
+    {
+        triplets.clear();
+        return true;
+    }
+
+    // the triplets are evaluated directly from the compressed-column arrays, the memory is
+    // allocated only if the capacity of the vector is smaller than the number of non zeros
+    triplets.resize(values.size());
+    const std::size_t cols = outerIndex.size() - 1;
+    for (std::size_t col = 0; col < cols; col++)
+    {
+        for (c_int k = outerIndex[col]; k < outerIndex[col + 1]; k++)
+        {
+            if ((innerIndex[k] < 0) || (innerIndex[k] >= rows))
+            {
+                OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::cachedMatrixToTriplets] The row index "
+                                     "of the cached matrix is out of range.");
+                return false;
+            }
+            triplets[k] = Eigen::Triplet<c_float>(static_cast<int>(innerIndex[k]),
+                                                  static_cast<int>(col),
+                                                  values[k]);
+        }
+    }
     return true;
 }
 
+void OsqpEigen::Solver::reserveScratchMemory()
+{
+    const std::size_t hessianNonZeros = m_hessianValues.size();
+    const std::size_t constraintsNonZeros = m_constraintsValues.size();
+
+    // the triplets of the new hessian contain both the upper and the lower triangular parts
+    m_oldHessianTriplet.reserve(hessianNonZeros);
+    m_newHessianTriplet.reserve(2 * hessianNonZeros);
+    m_newUpperTriangularHessianTriplets.reserve(hessianNonZeros);
+    m_oldLinearConstraintsTriplet.reserve(constraintsNonZeros);
+    m_newLinearConstraintsTriplet.reserve(constraintsNonZeros);
+
+    m_primalVariables.resize(getData()->n);
+    m_dualVariables.resize(getData()->m);
+    m_solution.resize(getData()->n);
+    m_dualSolution.resize(getData()->m);
+    m_bestPrimalIterate.resize(getData()->n);
+    m_bestDualIterate.resize(getData()->m);
+    m_convertedGradient.resize(getData()->n);
+    m_convertedLowerBound.resize(getData()->m);
+    m_convertedUpperBound.resize(getData()->m);
+}
+
+void OsqpEigen::Solver::collectOsqpInfoStats(const bool isSolveCompleted)
+{
+    const OSQPInfo* info = getInfo();
+#if defined(OSQP_EIGEN_OSQP_IS_V1) || defined(PROFILING)
+    m_stats.osqpSetupTime = info->setup_time;
+    m_stats.osqpUpdateTime = info->update_time;
+#endif
+
+    if (!isSolveCompleted)
+    {
+        return;
+    }
+
+    m_stats.iterations = info->iter;
+    m_stats.rhoUpdates = info->rho_updates;
+    m_stats.totalIterations += static_cast<std::size_t>(info->iter);
+#if defined(OSQP_EIGEN_OSQP_IS_V1) || defined(PROFILING)
+    m_stats.osqpSolveTime = info->solve_time;
+    m_stats.osqpPolishTime = info->polish_time;
+    m_stats.osqpRunTime = info->run_time;
+#endif
+}
+
+const OsqpEigen::SolverStats& OsqpEigen::Solver::stats() const
+{
+    return m_stats;
+}
+
+void OsqpEigen::Solver::resetStats()
+{
+    m_stats = OsqpEigen::SolverStats();
+}
+
+void OsqpEigen::Solver::setEventRingBuffer(std::shared_ptr<OsqpEigen::EventRingBuffer> buffer)
+{
+    m_eventRingBuffer = std::move(buffer);
+}
+
+const std::shared_ptr<OsqpEigen::EventRingBuffer>& OsqpEigen::Solver::eventRingBuffer() const
+{
+    return m_eventRingBuffer;
+}
+
 bool OsqpEigen::Solver::isInitialized()
 {
     return m_isSolverInitialized;
@@ -159,6 +490,21 @@ bool OsqpEigen::Solver::isInitialized()
 
 void OsqpEigen::Solver::clearSolver()
 {
+    // the pending asynchronous solves are completed before the workspace is deallocated. If the
+    // solver is cleared by the completion callback of a solve, e.g. by a matrix update that
+    // initializes the solver again, the worker cannot join itself. In this case it is kept and
+    // only the vectors queued for the old workspace are dropped
+    if (m_asyncWorker != nullptr)
+    {
+        if (m_asyncWorker->isWorkerThread())
+        {
+            m_asyncWorker->clearQueuedUpdates();
+        } else
+        {
+            m_asyncWorker.reset();
+        }
+    }
+
     if (m_isSolverInitialized)
     {
 #ifdef OSQP_EIGEN_OSQP_IS_V1
@@ -170,18 +516,38 @@ void OsqpEigen::Solver::clearSolver()
     }
 }
 
+void OsqpEigen::Solver::setSparsityPatternSuperset(const bool isSuperset)
+{
+    m_isSparsityPatternSuperset = isSuperset;
+}
+
+bool OsqpEigen::Solver::isSparsityPatternSuperset() const
+{
+    return m_isSparsityPatternSuperset;
+}
+
+void OsqpEigen::Solver::setRealTimeMode(const bool isEnabled)
+{
+    m_isRealTimeModeEnabled = isEnabled;
+}
+
+bool OsqpEigen::Solver::isRealTimeModeEnabled() const
+{
+    return m_isRealTimeModeEnabled;
+}
+
 bool OsqpEigen::Solver::solve()
 {
     if (this->solveProblem() != OsqpEigen::ErrorExitFlag::NoError)
     {
-        debugStream() << "[OsqpEigen::Solver::solve] Unable to solve the problem." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::solve] Unable to solve the problem.");
         return false;
     }
 
     // check if the solution is feasible
     if (this->getStatus() != OsqpEigen::Status::Solved)
     {
-        debugStream() << "[OsqpEigen::Solver::solve] The solution is unfeasible." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::solve] The solution is unfeasible.");
         return false;
     }
 
@@ -200,23 +566,317 @@ c_float OsqpEigen::Solver::getObjValue() const
 
 OsqpEigen::ErrorExitFlag OsqpEigen::Solver::solveProblem()
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::solveProblem] The solve has not been initialized "
-                         "yet. "
-                      << "Please call initSolver() method." << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::solveProblem] The solve has not been initialized "
+                             "yet. Please call initSolver() method.");
         return OsqpEigen::ErrorExitFlag::WorkspaceNotInitError;
     }
 
+    if (!applyQueuedUpdates())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::solveProblem] Unable to update the vectors "
+                             "queued during an asynchronous solve.");
+        return OsqpEigen::ErrorExitFlag::DataValidationError;
+    }
+
+    OsqpEigen::SolverEventScope event(m_eventRingBuffer.get(),
+                                      OsqpEigen::SolverEventType::SolveProblem,
+                                      this);
+
+    OsqpEigen::ErrorExitFlag exitFlag;
+    {
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.solve);
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+        exitFlag = static_cast<OsqpEigen::ErrorExitFlag>(osqp_solve(m_solver.get()));
+#else
+        exitFlag = static_cast<OsqpEigen::ErrorExitFlag>(osqp_solve(m_workspace.get()));
+#endif
+    }
+
+    OSQP_EIGEN_STATS_UPDATE(collectOsqpInfoStats(true));
+    event.setExitFlag(static_cast<int>(exitFlag));
+    event.setStatus(static_cast<int>(getStatus()));
+    return exitFlag;
+}
+
+OsqpEigen::ErrorExitFlag OsqpEigen::Solver::solveProblem(const std::atomic<bool>& cancel)
+{
+    return solveProblem(std::chrono::steady_clock::time_point::max(), &cancel);
+}
+
+OsqpEigen::ErrorExitFlag
+OsqpEigen::Solver::solveProblem(const std::chrono::steady_clock::time_point deadline,
+                                const std::atomic<bool>* cancel)
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::solveProblem] The solve has not been initialized "
+                             "yet. Please call initSolver() method.");
+        return OsqpEigen::ErrorExitFlag::WorkspaceNotInitError;
+    }
+
+    if (!applyQueuedUpdates())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::solveProblem] Unable to update the vectors "
+                             "queued during an asynchronous solve.");
+        return OsqpEigen::ErrorExitFlag::DataValidationError;
+    }
+
+    OsqpEigen::SolverEventScope event(m_eventRingBuffer.get(),
+                                      OsqpEigen::SolverEventType::SolveProblem,
+                                      this);
+
+    // the settings of the workspace are changed for each chunk and restored at the end
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    OSQPSettings* settings = m_solver->settings;
+    OSQPInfo* info = m_solver->info;
+    OSQPSolution* solution = m_solver->solution;
+    c_int& warmStart = settings->warm_starting;
+#else
+    OSQPSettings* settings = m_workspace->settings;
+    OSQPInfo* info = m_workspace->info;
+    OSQPSolution* solution = m_workspace->solution;
+    c_int& warmStart = settings->warm_start;
+#endif
+    const c_int n = getData()->n;
+    const c_int m = getData()->m;
+    const c_int maxIteration = settings->max_iter;
+    const c_int isWarmStartEnabled = warmStart;
+
+    // if the interval is zero osqp updates rho after a fraction of the setup time measured from
+    // the beginning of osqp_solve(), which restarts with each chunk. The chunks use the interval
+    // chosen by osqp when the time is not measured instead
+    const c_int adaptiveRhoInterval = settings->adaptive_rho_interval;
+    if (settings->adaptive_rho && (adaptiveRhoInterval == 0))
+    {
+        settings->adaptive_rho_interval
+            = (settings->check_termination > 0)
+                  ? adaptiveRhoMultipleTermination * settings->check_termination
+                  : adaptiveRhoFixedInterval;
+    }
+    const c_int chunkIterations = iterationsPerChunk(*settings);
+    const bool hasDeadline = (deadline != std::chrono::steady_clock::time_point::max());
+#if defined(PROFILING) || defined(OSQP_ENABLE_PROFILING)
+    const c_float timeLimit = settings->time_limit;
+    c_float solveTime = 0;
+    c_float polishTime = 0;
+#endif
+
+    OsqpEigen::ErrorExitFlag exitFlag = OsqpEigen::ErrorExitFlag::NoError;
+    c_int iterations = 0;
+    c_int rhoUpdates = 0;
+    bool isCancelled = false;
+    bool isDeadlineReached = false;
+    bool hasBestIterate = false;
+    c_float bestPrimalResidual = 0;
+    c_float bestDualResidual = 0;
+    {
+        OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.solve);
+        while (true)
+        {
+            isCancelled = (cancel != nullptr) && cancel->load(std::memory_order_relaxed);
+            if (isCancelled)
+            {
+                break;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            isDeadlineReached = hasDeadline && (now >= deadline);
+            if (isDeadlineReached)
+            {
+                break;
+            }
+
+            // osqp_solve() does not reset the status, a chunk that does not terminate would keep
+            // the one of the previous chunk
+            setStatus(info, OSQP_UNSOLVED, "unsolved");
+            settings->max_iter = std::min(chunkIterations, maxIteration - iterations);
+#if defined(PROFILING) || defined(OSQP_ENABLE_PROFILING)
+            // the chunk is stopped by osqp when the deadline is reached
+            c_float chunkTimeLimit = (timeLimit > 0) ? timeLimit - solveTime - polishTime : 0;
+            if (hasDeadline)
+            {
+                const c_float timeToDeadline
+                    = std::chrono::duration<c_float>(deadline - now).count();
+                chunkTimeLimit = (chunkTimeLimit > 0) ? std::min(chunkTimeLimit, timeToDeadline)
+                                                      : timeToDeadline;
+            }
+            settings->time_limit = chunkTimeLimit;
+#endif
+
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+            exitFlag = static_cast<OsqpEigen::ErrorExitFlag>(osqp_solve(m_solver.get()));
+#else
+            exitFlag = static_cast<OsqpEigen::ErrorExitFlag>(osqp_solve(m_workspace.get()));
+#endif
+            iterations += info->iter;
+            rhoUpdates += info->rho_updates;
+#if defined(PROFILING) || defined(OSQP_ENABLE_PROFILING)
+            solveTime += info->solve_time;
+            polishTime += info->polish_time;
+#endif
+
+            // the next chunk starts from the last iterate
+            warmStart = 1;
+
+            if (exitFlag != OsqpEigen::ErrorExitFlag::NoError)
+            {
+                break;
+            }
+
+            // the iterate with the smallest residuals is kept, it is reported if the solve does
+            // not converge
+            if (hasIterate(info->status_val)
+                && (!hasBestIterate
+                    || (largestResidual(*info) < std::max(bestPrimalResidual, bestDualResidual))))
+            {
+                m_bestPrimalIterate = Eigen::Map<const Eigen::Matrix<c_float, -1, 1>>(solution->x,
+                                                                                      n);
+                m_bestDualIterate = Eigen::Map<const Eigen::Matrix<c_float, -1, 1>>(solution->y,
+                                                                                    m);
+                bestPrimalResidual = primalResidual(*info);
+                bestDualResidual = dualResidual(*info);
+                hasBestIterate = true;
+            }
+
+            if (!isChunkInterrupted(info->status_val) || (iterations >= maxIteration))
+            {
+                break;
+            }
+
+#if defined(PROFILING) || defined(OSQP_ENABLE_PROFILING)
+            if ((timeLimit > 0) && (solveTime + polishTime >= timeLimit))
+            {
+                setStatus(info, OSQP_TIME_LIMIT_REACHED, "run time limit reached");
+                break;
+            }
+#endif
+        }
+    }
+
+    settings->max_iter = maxIteration;
+    settings->adaptive_rho_interval = adaptiveRhoInterval;
+    warmStart = isWarmStartEnabled;
+#if defined(PROFILING) || defined(OSQP_ENABLE_PROFILING)
+    settings->time_limit = timeLimit;
+    info->solve_time = solveTime;
+    info->polish_time = polishTime;
+#endif
+    info->iter = iterations;
+    info->rho_updates = rhoUpdates;
+    if (isCancelled)
+    {
+        setStatus(info, OSQP_SIGINT, "interrupted");
+    } else if (isDeadlineReached)
+    {
+        setStatus(info, OSQP_TIME_LIMIT_REACHED, "run time limit reached");
+    }
+
+    // the workspace keeps the last iterate, hence the next solve is warm started from it
+    if ((exitFlag == OsqpEigen::ErrorExitFlag::NoError) && hasBestIterate
+        && hasIterate(info->status_val)
+        && (std::max(bestPrimalResidual, bestDualResidual) < largestResidual(*info)))
+    {
+        std::copy(m_bestPrimalIterate.data(), m_bestPrimalIterate.data() + n, solution->x);
+        std::copy(m_bestDualIterate.data(), m_bestDualIterate.data() + m, solution->y);
+        primalResidual(*info) = bestPrimalResidual;
+        dualResidual(*info) = bestDualResidual;
+    }
+
+    OSQP_EIGEN_STATS_UPDATE(collectOsqpInfoStats(true));
+    event.setExitFlag(static_cast<int>(exitFlag));
+    event.setStatus(static_cast<int>(getStatus()));
+    return exitFlag;
+}
+
+std::future<OsqpEigen::ErrorExitFlag>
+OsqpEigen::Solver::solveAsync(std::function<void(OsqpEigen::ErrorExitFlag)> onCompletion)
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::solveAsync] The solve has not been initialized "
+                             "yet. Please call initSolver() method.");
+        std::promise<OsqpEigen::ErrorExitFlag> promise;
+        promise.set_value(OsqpEigen::ErrorExitFlag::WorkspaceNotInitError);
+        return promise.get_future();
+    }
+
+    // the worker is started by the first asynchronous solve
+    if (m_asyncWorker == nullptr)
+    {
+        m_asyncWorker = std::make_unique<OsqpEigen::AsyncSolveWorker>(getData()->n,
+                                                                      getData()->m);
+        if (m_asyncWorkerCpu >= 0)
+        {
+            m_asyncWorker->setCpuAffinity(m_asyncWorkerCpu);
+        }
+    }
+
+    return m_asyncWorker->submit([this, onCompletion]() {
+        const OsqpEigen::ErrorExitFlag exitFlag = solveProblem();
+        if (onCompletion)
+        {
+            onCompletion(exitFlag);
+        }
+        return exitFlag;
+    });
+}
+
+bool OsqpEigen::Solver::setAsyncWorkerCpuAffinity(const int cpu)
+{
+    m_asyncWorkerCpu = cpu;
+    return (m_asyncWorker == nullptr) || m_asyncWorker->setCpuAffinity(cpu);
+}
+
+bool OsqpEigen::Solver::applyQueuedUpdates()
+{
+    if (m_asyncWorker == nullptr)
+    {
+        return true;
+    }
+
+    return m_asyncWorker->applyQueuedUpdates(
+        [this](const c_float* gradient, const c_float* lowerBound, const c_float* upperBound) {
+            OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.vectorUpdate);
 #ifdef OSQP_EIGEN_OSQP_IS_V1
-    return static_cast<OsqpEigen::ErrorExitFlag>(osqp_solve(m_solver.get()));
+            if (osqp_update_data_vec(m_solver.get(), gradient, lowerBound, upperBound))
+            {
+                return false;
+            }
 #else
-    return static_cast<OsqpEigen::ErrorExitFlag>(osqp_solve(m_workspace.get()));
+            if ((gradient != nullptr) && osqp_update_lin_cost(m_workspace.get(), gradient))
+            {
+                return false;
+            }
+            if ((lowerBound != nullptr) && (upperBound != nullptr))
+            {
+                if (osqp_update_bounds(m_workspace.get(), lowerBound, upperBound))
+                {
+                    return false;
+                }
+            } else if ((lowerBound != nullptr)
+                       && osqp_update_lower_bound(m_workspace.get(), lowerBound))
+            {
+                return false;
+            } else if ((upperBound != nullptr)
+                       && osqp_update_upper_bound(m_workspace.get(), upperBound))
+            {
+                return false;
+            }
 #endif
+            return true;
+        });
 }
 
 const Eigen::Matrix<c_float, -1, 1>& OsqpEigen::Solver::getSolution()
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     // copy data from an array to Eigen vector
     c_float* solution = getOSQPSolution()->x;
     m_solution = Eigen::Map<Eigen::Matrix<c_float, -1, 1>>(solution, getData()->n, 1);
@@ -226,6 +886,8 @@ const Eigen::Matrix<c_float, -1, 1>& OsqpEigen::Solver::getSolution()
 
 const Eigen::Matrix<c_float, -1, 1>& OsqpEigen::Solver::getDualSolution()
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     // copy data from an array to Eigen vector
     c_float* solution = getOSQPSolution()->y;
     m_dualSolution = Eigen::Map<Eigen::Matrix<c_float, -1, 1>>(solution, getData()->m, 1);
@@ -233,6 +895,190 @@ const Eigen::Matrix<c_float, -1, 1>& OsqpEigen::Solver::getDualSolution()
     return m_dualSolution;
 }
 
+bool OsqpEigen::Solver::getHessianSparsityPattern(std::vector<c_int>& outerIndex,
+                                                  std::vector<c_int>& innerIndex) const
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::getHessianSparsityPattern] The solver is not "
+                             "initialized.");
+        return false;
+    }
+
+    outerIndex = m_hessianOuterIndex;
+    innerIndex = m_hessianInnerIndex;
+    return true;
+}
+
+bool OsqpEigen::Solver::getLinearConstraintsSparsityPattern(std::vector<c_int>& outerIndex,
+                                                            std::vector<c_int>& innerIndex) const
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::getLinearConstraintsSparsityPattern] The solver "
+                             "is not initialized.");
+        return false;
+    }
+
+    outerIndex = m_constraintsOuterIndex;
+    innerIndex = m_constraintsInnerIndex;
+    return true;
+}
+
+bool OsqpEigen::Solver::detachData()
+{
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::detachData] The solver is not initialized.");
+        return false;
+    }
+
+    const c_int n = getData()->n;
+    const c_int m = getData()->m;
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> gradient(n);
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> lowerBound(m);
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> upperBound(m);
+    getSolverVectors(gradient, lowerBound, upperBound);
+
+    // the cached matrices are aligned with the ones stored in the solver
+    const Eigen::Map<const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>>
+        hessian(n,
+                n,
+                static_cast<Eigen::Index>(m_hessianValues.size()),
+                m_hessianOuterIndex.data(),
+                m_hessianInnerIndex.data(),
+                m_hessianValues.data());
+    const Eigen::Map<const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>>
+        linearConstraints(m,
+                          n,
+                          static_cast<Eigen::Index>(m_constraintsValues.size()),
+                          m_constraintsOuterIndex.data(),
+                          m_constraintsInnerIndex.data(),
+                          m_constraintsValues.data());
+
+    m_data->clearHessianMatrix();
+    m_data->clearLinearConstraintsMatrix();
+    m_data->setVectorsCopy(true);
+    if (!m_data->setHessianMatrix(hessian, true)
+        || !m_data->setLinearConstraintsMatrix(linearConstraints) || !m_data->setGradient(gradient)
+        || !m_data->setBounds(lowerBound, upperBound))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::detachData] Unable to copy the data stored in "
+                             "the solver.");
+        return false;
+    }
+    return true;
+}
+
+Eigen::Map<const Eigen::Matrix<c_float, -1, 1>> OsqpEigen::Solver::solutionView() const
+{
+    if (!m_isSolverInitialized)
+    {
+        return Eigen::Map<const Eigen::Matrix<c_float, -1, 1>>(nullptr, 0);
+    }
+
+    return Eigen::Map<const Eigen::Matrix<c_float, -1, 1>>(getOSQPSolution()->x, getData()->n);
+}
+
+Eigen::Map<const Eigen::Matrix<c_float, -1, 1>> OsqpEigen::Solver::dualSolutionView() const
+{
+    if (!m_isSolverInitialized)
+    {
+        return Eigen::Map<const Eigen::Matrix<c_float, -1, 1>>(nullptr, 0);
+    }
+
+    return Eigen::Map<const Eigen::Matrix<c_float, -1, 1>>(getOSQPSolution()->y, getData()->m);
+}
+
+bool OsqpEigen::Solver::copySolutionTo(Eigen::Ref<Eigen::Matrix<c_float, -1, 1>> solution) const
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copySolutionTo] The solver is not initialized");
+        return false;
+    }
+
+    // a Ref can not be resized, hence the copy never allocates memory
+    if (solution.rows() != getData()->n)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copySolutionTo] The size of the vector must be "
+                             "equal to the number of the variables.");
+        return false;
+    }
+
+    solution = solutionView();
+    return true;
+}
+
+bool OsqpEigen::Solver::copyDualSolutionTo(
+    Eigen::Ref<Eigen::Matrix<c_float, -1, 1>> dualSolution) const
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copyDualSolutionTo] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    if (dualSolution.rows() != getData()->m)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::copyDualSolutionTo] The size of the vector must "
+                             "be equal to the number of the constraints.");
+        return false;
+    }
+
+    dualSolution = dualSolutionView();
+    return true;
+}
+
+bool OsqpEigen::Solver::warmStartShifted(
+    const std::vector<OsqpEigen::StageBlock>& primalStageBlocks,
+    const std::vector<OsqpEigen::StageBlock>& dualStageBlocks)
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::warmStartShifted] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    OSQPSolution* solution = m_solver->solution;
+#else
+    OSQPSolution* solution = m_workspace->solution;
+#endif
+    if (solution == nullptr)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::warmStartShifted] The solution is not "
+                             "allocated.");
+        return false;
+    }
+
+    if (!isStageBlocksSizeValid(primalStageBlocks, getData()->n)
+        || !isStageBlocksSizeValid(dualStageBlocks, getData()->m))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::warmStartShifted] The size of the blocks has to "
+                             "be equal to the number of variables and of constraints.");
+        return false;
+    }
+
+    shiftStages(solution->x, primalStageBlocks);
+    shiftStages(solution->y, dualStageBlocks);
+
+    // OSQP copies the vectors in its iterates, hence the solution can be passed directly
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    return (osqp_warm_start(m_solver.get(), solution->x, solution->y) == 0);
+#else
+    return (osqp_warm_start(m_workspace.get(), solution->x, solution->y) == 0);
+#endif
+}
+
 const std::unique_ptr<OsqpEigen::Settings>& OsqpEigen::Solver::settings() const
 {
     return m_settings;
@@ -260,23 +1106,30 @@ OsqpEigen::Solver::workspace() const
 bool OsqpEigen::Solver::updateGradient(
     const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& gradient)
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::updateGradient] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateGradient] The solver is not initialized");
         return false;
     }
 
     // check if the dimension of the gradient is correct
     if (gradient.rows() != getData()->n)
     {
-        debugStream() << "[OsqpEigen::Solver::updateGradient] The size of the gradient must be "
-                         "equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateGradient] The size of the gradient must be "
+                             "equal to the number of the variables.");
         return false;
     }
 
+    // while an asynchronous solve is pending the gradient is sent before the next solve
+    if ((m_asyncWorker != nullptr) && m_asyncWorker->queueGradient(gradient))
+    {
+        return true;
+    }
+
     // update the gradient vector
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.vectorUpdate);
 #ifdef OSQP_EIGEN_OSQP_IS_V1
     if (osqp_update_data_vec(m_solver.get(), gradient.data(), nullptr, nullptr))
     {
@@ -284,34 +1137,51 @@ bool OsqpEigen::Solver::updateGradient(
     if (osqp_update_lin_cost(m_workspace.get(), gradient.data()))
     {
 #endif
-        debugStream() << "[OsqpEigen::Solver::updateGradient] Error when the update gradient is "
-                         "called."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateGradient] Error when the update gradient "
+                             "is called.");
         return false;
     }
+
     return true;
 }
 
 bool OsqpEigen::Solver::updateLowerBound(
     const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound)
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::updateLowerBound] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLowerBound] The solver is not initialized");
         return false;
     }
 
     // check if the dimension of the lowerBound vector is correct
     if (lowerBound.rows() != getData()->m)
     {
-        debugStream() << "[OsqpEigen::Solver::updateLowerBound] The size of the lower bound must "
-                         "be equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLowerBound] The size of the lower bound "
+                             "must be equal to the number of the variables.");
         return false;
     }
 
+    // while an asynchronous solve is pending the bounds are checked and queued
+    if (m_asyncWorker != nullptr)
+    {
+        const AsyncSolveWorker::QueueResult result = m_asyncWorker->queueLowerBound(lowerBound);
+        if (result == AsyncSolveWorker::QueueResult::Rejected)
+        {
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLowerBound] The lower bound is greater "
+                                 "than the queued upper bound.");
+            return false;
+        }
+        if (result == AsyncSolveWorker::QueueResult::Queued)
+        {
+            return true;
+        }
+    }
+
     // update the lower bound vector
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.vectorUpdate);
 #ifdef OSQP_EIGEN_OSQP_IS_V1
     if (osqp_update_data_vec(m_solver.get(), nullptr, lowerBound.data(), nullptr))
     {
@@ -319,9 +1189,8 @@ bool OsqpEigen::Solver::updateLowerBound(
     if (osqp_update_lower_bound(m_workspace.get(), lowerBound.data()))
     {
 #endif
-        debugStream() << "[OsqpEigen::Solver::updateLowerBound] Error when the update lower bound "
-                         "is called."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLowerBound] Error when the update lower "
+                             "bound is called.");
         return false;
     }
 
@@ -331,23 +1200,40 @@ bool OsqpEigen::Solver::updateLowerBound(
 bool OsqpEigen::Solver::updateUpperBound(
     const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound)
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::updateUpperBound] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateUpperBound] The solver is not initialized");
         return false;
     }
 
     // check if the dimension of the upperBound vector is correct
     if (upperBound.rows() != getData()->m)
     {
-        debugStream() << "[OsqpEigen::Solver::updateUpperBound] The size of the upper bound must "
-                         "be equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateUpperBound] The size of the upper bound "
+                             "must be equal to the number of the variables.");
         return false;
     }
 
+    // while an asynchronous solve is pending the bounds are checked and queued
+    if (m_asyncWorker != nullptr)
+    {
+        const AsyncSolveWorker::QueueResult result = m_asyncWorker->queueUpperBound(upperBound);
+        if (result == AsyncSolveWorker::QueueResult::Rejected)
+        {
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateUpperBound] The upper bound is lower "
+                                 "than the queued lower bound.");
+            return false;
+        }
+        if (result == AsyncSolveWorker::QueueResult::Queued)
+        {
+            return true;
+        }
+    }
+
     // update the upper bound vector
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.vectorUpdate);
 #ifdef OSQP_EIGEN_OSQP_IS_V1
     if (osqp_update_data_vec(m_solver.get(), nullptr, nullptr, upperBound.data()))
     {
@@ -355,11 +1241,11 @@ bool OsqpEigen::Solver::updateUpperBound(
     if (osqp_update_upper_bound(m_workspace.get(), upperBound.data()))
     {
 #endif
-        debugStream() << "[OsqpEigen::Solver::updateUpperBound] Error when the update upper bound "
-                         "is called."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateUpperBound] Error when the update upper "
+                             "bound is called.");
         return false;
     }
+
     return true;
 }
 
@@ -367,32 +1253,49 @@ bool OsqpEigen::Solver::updateBounds(
     const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& lowerBound,
     const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& upperBound)
 {
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
     if (!m_isSolverInitialized)
     {
-        debugStream() << "[OsqpEigen::Solver::updateBounds] The solver is not initialized"
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateBounds] The solver is not initialized");
         return false;
     }
 
     // check if the dimension of the upperBound vector is correct
     if (upperBound.rows() != getData()->m)
     {
-        debugStream() << "[OsqpEigen::Solver::updateBounds] The size of the upper bound must be "
-                         "equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateBounds] The size of the upper bound must "
+                             "be equal to the number of the variables.");
         return false;
     }
 
     // check if the dimension of the lowerBound vector is correct
     if (lowerBound.rows() != getData()->m)
     {
-        debugStream() << "[OsqpEigen::Solver::updateBounds] The size of the lower bound must be "
-                         "equal to the number of the variables."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateBounds] The size of the lower bound must "
+                             "be equal to the number of the variables.");
         return false;
     }
 
+    // while an asynchronous solve is pending the bounds are checked and queued
+    if (m_asyncWorker != nullptr)
+    {
+        const AsyncSolveWorker::QueueResult result
+            = m_asyncWorker->queueBounds(lowerBound, upperBound);
+        if (result == AsyncSolveWorker::QueueResult::Rejected)
+        {
+            OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateBounds] The lower bound is greater "
+                                 "than the upper bound.");
+            return false;
+        }
+        if (result == AsyncSolveWorker::QueueResult::Queued)
+        {
+            return true;
+        }
+    }
+
     // update lower and upper constraints
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.vectorUpdate);
 #ifdef OSQP_EIGEN_OSQP_IS_V1
     if (osqp_update_data_vec(m_solver.get(), nullptr, lowerBound.data(), upperBound.data()))
     {
@@ -400,9 +1303,159 @@ bool OsqpEigen::Solver::updateBounds(
     if (osqp_update_bounds(m_workspace.get(), lowerBound.data(), upperBound.data()))
     {
 #endif
-        debugStream() << "[OsqpEigen::Solver::updateBounds] Error when the update bounds is called."
-                      << std::endl;
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateBounds] Error when the update bounds is "
+                             "called.");
+        return false;
+    }
+
+    return true;
+}
+
+bool OsqpEigen::Solver::updateVectorsFromData()
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateVectorsFromData] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    if (!m_data->isSet())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateVectorsFromData] Some data are not set.");
+        return false;
+    }
+
+    const OSQPData* data = m_data->getData();
+
+    // the bounds are not set if there are no constraints
+    c_float* lowerBound = (data->m > 0) ? data->l : nullptr;
+    c_float* upperBound = (data->m > 0) ? data->u : nullptr;
+
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.vectorUpdate);
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    if (osqp_update_data_vec(m_solver.get(), data->q, lowerBound, upperBound))
+    {
+#else
+    if (osqp_update_lin_cost(m_workspace.get(), data->q)
+        || ((data->m > 0) && osqp_update_bounds(m_workspace.get(), lowerBound, upperBound)))
+    {
+#endif
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateVectorsFromData] Error when the update of "
+                             "the vectors is called.");
+        return false;
+    }
+
+    return true;
+}
+
+bool OsqpEigen::Solver::updateHessianValues(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& hessianValues)
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianValues] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    // check if the number of values is equal to the number of non zeros of the hessian
+    if (hessianValues.rows() != static_cast<Eigen::Index>(m_hessianValues.size()))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianValues] The number of values must "
+                             "be equal to the number of non zeros of the upper triangular part of "
+                             "the hessian matrix.");
+        return false;
+    }
+
+    // all the values are updated, hence the indices are not required
+    OSQP_EIGEN_STATS_UPDATE(m_stats.lastChangedValues = m_hessianValues.size());
+    OSQP_EIGEN_STATS_UPDATE(m_stats.totalChangedValues += m_hessianValues.size());
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.matrixUpdate);
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    if (osqp_update_data_mat(m_solver.get(),
+                             hessianValues.data(),
+                             nullptr,
+                             hessianValues.rows(),
+                             nullptr,
+                             nullptr,
+                             0)
+        != 0)
+    {
+#else
+    if (osqp_update_P(m_workspace.get(), hessianValues.data(), OSQP_NULL, hessianValues.rows())
+        != 0)
+    {
+#endif
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateHessianValues] Unable to update hessian "
+                             "matrix.");
         return false;
     }
+
+    // keep the cached values aligned with the ones stored in the solver
+    Eigen::Map<Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(m_hessianValues.data(),
+                                                          m_hessianValues.size())
+        = hessianValues;
+
+    return true;
+}
+
+bool OsqpEigen::Solver::updateLinearConstraintsValues(
+    const Eigen::Ref<const Eigen::Matrix<c_float, Eigen::Dynamic, 1>>& linearConstraintsValues)
+{
+    OSQP_EIGEN_HOT_PATH_SCOPE;
+
+    if (!m_isSolverInitialized)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsValues] The solver is not "
+                             "initialized");
+        return false;
+    }
+
+    // check if the number of values is equal to the number of non zeros of the constraints
+    if (linearConstraintsValues.rows() != static_cast<Eigen::Index>(m_constraintsValues.size()))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsValues] The number of "
+                             "values must be equal to the number of non zeros of the linear "
+                             "constraints matrix.");
+        return false;
+    }
+
+    // all the values are updated, hence the indices are not required
+    OSQP_EIGEN_STATS_UPDATE(m_stats.lastChangedValues = m_constraintsValues.size());
+    OSQP_EIGEN_STATS_UPDATE(m_stats.totalChangedValues += m_constraintsValues.size());
+    OSQP_EIGEN_STATS_PHASE_SCOPE(m_stats.matrixUpdate);
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    if (osqp_update_data_mat(m_solver.get(),
+                             nullptr,
+                             nullptr,
+                             0,
+                             linearConstraintsValues.data(),
+                             nullptr,
+                             linearConstraintsValues.rows())
+        != 0)
+    {
+#else
+    if (osqp_update_A(m_workspace.get(),
+                      linearConstraintsValues.data(),
+                      OSQP_NULL,
+                      linearConstraintsValues.rows())
+        != 0)
+    {
+#endif
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::Solver::updateLinearConstraintsValues] Unable to update "
+                             "linear constraints matrix.");
+        return false;
+    }
+
+    // keep the cached values aligned with the ones stored in the solver
+    Eigen::Map<Eigen::Matrix<c_float, Eigen::Dynamic, 1>>(m_constraintsValues.data(),
+                                                          m_constraintsValues.size())
+        = linearConstraintsValues;
+
     return true;
 }
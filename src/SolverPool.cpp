@@ -0,0 +1,208 @@
+/**
+ * @file SolverPool.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// OsqpEigen
+#include <OsqpEigen/Logging.hpp>
+#include <OsqpEigen/SolverPool.hpp>
+
+namespace
+{
+void combineHash(std::size_t& seed, std::size_t value)
+{
+    seed ^= value + static_cast<std::size_t>(0x9e3779b9) + (seed << 6) + (seed >> 2);
+}
+
+// the sparsity pattern is stored in compressed-column form, hence the same row indices split in
+// different columns give a different pattern
+template <typename Matrix>
+void computePattern(const Matrix& matrix,
+                    bool isUpperTriangular,
+                    std::vector<c_int>& outerIndex,
+                    std::vector<c_int>& innerIndex)
+{
+    outerIndex.assign(1, 0);
+    outerIndex.reserve(static_cast<std::size_t>(matrix.outerSize()) + 1);
+    innerIndex.clear();
+    innerIndex.reserve(static_cast<std::size_t>(matrix.nonZeros()));
+    for (Eigen::Index k = 0; k < matrix.outerSize(); k++)
+    {
+        for (typename Matrix::InnerIterator it(matrix, k); it; ++it)
+        {
+            if (isUpperTriangular && (it.row() > it.col()))
+            {
+                continue;
+            }
+            innerIndex.push_back(static_cast<c_int>(it.row()));
+        }
+        outerIndex.push_back(static_cast<c_int>(innerIndex.size()));
+    }
+}
+
+std::size_t computePatternHash(const std::vector<c_int>& outerIndex,
+                               const std::vector<c_int>& innerIndex)
+{
+    std::size_t seed = 0;
+    for (c_int index : outerIndex)
+    {
+        combineHash(seed, static_cast<std::size_t>(index));
+    }
+    for (c_int index : innerIndex)
+    {
+        combineHash(seed, static_cast<std::size_t>(index));
+    }
+    return seed;
+}
+} // namespace
+
+bool OsqpEigen::SolverPool::Key::operator==(const Key& other) const
+{
+    // the hashes are compared first, the patterns are compared only if they are equal
+    return (numberOfVariables == other.numberOfVariables)
+           && (numberOfConstraints == other.numberOfConstraints)
+           && (hessianPatternHash == other.hessianPatternHash)
+           && (linearConstraintsPatternHash == other.linearConstraintsPatternHash)
+           && (hessianOuterIndex == other.hessianOuterIndex)
+           && (hessianInnerIndex == other.hessianInnerIndex)
+           && (linearConstraintsOuterIndex == other.linearConstraintsOuterIndex)
+           && (linearConstraintsInnerIndex == other.linearConstraintsInnerIndex);
+}
+
+std::size_t OsqpEigen::SolverPool::KeyHash::operator()(const Key& key) const
+{
+    std::size_t seed = 0;
+    combineHash(seed, static_cast<std::size_t>(key.numberOfVariables));
+    combineHash(seed, static_cast<std::size_t>(key.numberOfConstraints));
+    combineHash(seed, key.hessianPatternHash);
+    combineHash(seed, key.linearConstraintsPatternHash);
+    return seed;
+}
+
+OsqpEigen::SolverPool::SolverPool(std::size_t maximumNumberOfSolversPerKey)
+    : m_maximumNumberOfSolversPerKey(maximumNumberOfSolversPerKey)
+{
+}
+
+OsqpEigen::SolverPool::Key
+OsqpEigen::SolverPool::computeKey(const Eigen::SparseMatrix<c_float>& hessianMatrix,
+                                  const Eigen::SparseMatrix<c_float>& linearConstraintsMatrix)
+{
+    Key key;
+    key.numberOfVariables = static_cast<c_int>(hessianMatrix.cols());
+    key.numberOfConstraints = static_cast<c_int>(linearConstraintsMatrix.rows());
+    computePattern(hessianMatrix, true, key.hessianOuterIndex, key.hessianInnerIndex);
+    computePattern(linearConstraintsMatrix,
+                   false,
+                   key.linearConstraintsOuterIndex,
+                   key.linearConstraintsInnerIndex);
+    key.hessianPatternHash = computePatternHash(key.hessianOuterIndex, key.hessianInnerIndex);
+    key.linearConstraintsPatternHash
+        = computePatternHash(key.linearConstraintsOuterIndex, key.linearConstraintsInnerIndex);
+    return key;
+}
+
+OsqpEigen::SolverPool::Key OsqpEigen::SolverPool::computeKey(OsqpEigen::Solver& solver)
+{
+    // the patterns cached by the solver are used, since the matrices set in Data may be borrowed
+    // from a caller that has already destroyed them
+    Key key;
+    if (!solver.getHessianSparsityPattern(key.hessianOuterIndex, key.hessianInnerIndex)
+        || !solver.getLinearConstraintsSparsityPattern(key.linearConstraintsOuterIndex,
+                                                       key.linearConstraintsInnerIndex))
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SolverPool::computeKey] Unable to get the sparsity "
+                             "patterns of the solver.");
+        return Key();
+    }
+
+    key.numberOfVariables = solver.data()->getData()->n;
+    key.numberOfConstraints = solver.data()->getData()->m;
+    key.hessianPatternHash = computePatternHash(key.hessianOuterIndex, key.hessianInnerIndex);
+    key.linearConstraintsPatternHash
+        = computePatternHash(key.linearConstraintsOuterIndex, key.linearConstraintsInnerIndex);
+    return key;
+}
+
+std::unique_ptr<OsqpEigen::Solver> OsqpEigen::SolverPool::acquire(const Key& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto solvers = m_solvers.find(key);
+    if ((solvers == m_solvers.end()) || solvers->second.empty())
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<OsqpEigen::Solver> solver = std::move(solvers->second.back());
+    solvers->second.pop_back();
+    return solver;
+}
+
+bool OsqpEigen::SolverPool::release(std::unique_ptr<OsqpEigen::Solver> solver)
+{
+    if (solver == nullptr)
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SolverPool::release] The solver is a null pointer.");
+        return false;
+    }
+
+    if (!solver->isInitialized())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SolverPool::release] The solver is not initialized.");
+        return false;
+    }
+
+    if (!solver->clearSolverVariables())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SolverPool::release] Unable to clear the solver "
+                             "variables.");
+        return false;
+    }
+
+    // the Data object may point to the vectors and to the borrowed matrices of the caller, which
+    // can be destroyed while the solver is in the pool
+    if (!solver->detachData())
+    {
+        OSQP_EIGEN_LOG_ERROR("[OsqpEigen::SolverPool::release] Unable to copy the data of the "
+                             "solver.");
+        return false;
+    }
+
+    // the key is computed before locking the pool, the other threads are not blocked while the
+    // sparsity patterns are copied and hashed
+    const Key key = computeKey(*solver);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::unique_ptr<OsqpEigen::Solver>>& solvers = m_solvers[key];
+    if (solvers.size() >= m_maximumNumberOfSolversPerKey)
+    {
+        return false;
+    }
+    solvers.push_back(std::move(solver));
+    return true;
+}
+
+std::size_t OsqpEigen::SolverPool::getNumberOfSolvers()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::size_t numberOfSolvers = 0;
+    for (const auto& solvers : m_solvers)
+    {
+        numberOfSolvers += solvers.second.size();
+    }
+    return numberOfSolvers;
+}
+
+std::size_t OsqpEigen::SolverPool::getNumberOfSolvers(const Key& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto solvers = m_solvers.find(key);
+    return (solvers == m_solvers.end()) ? 0 : solvers->second.size();
+}
+
+void OsqpEigen::SolverPool::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_solvers.clear();
+}
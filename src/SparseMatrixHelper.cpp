@@ -0,0 +1,112 @@
+/**
+ * @file SparseMatrixHelper.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Std
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// OsqpEigen
+#include <OsqpEigen/Logging.hpp>
+#include <OsqpEigen/SparseMatrixHelper.hpp>
+#include <OsqpEigen/ThreadPool.hpp>
+
+namespace
+{
+#ifdef OSQP_EIGEN_PARALLEL_MATRIX_CONSTRUCTION
+std::size_t defaultNumberOfThreads()
+{
+    // hardware_concurrency() returns zero if the value is not computable
+    const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+    return std::min(std::max<std::size_t>(hardwareThreads, 1),
+                    OsqpEigen::SparseMatrixHelper::maximumNumberOfParallelThreads);
+}
+
+/**
+ * MatrixThreadPool contains the pool shared by all the matrices. The pool is created by the first
+ * parallel call, hence the programs that process only small matrices do not start any thread.
+ * The mutex is locked only to get the pool. A call that finds the pool busy with the matrix of
+ * another thread processes its matrix sequentially instead of waiting, so that the solvers used
+ * by different threads are never serialized.
+ */
+struct MatrixThreadPool
+{
+    std::mutex mutex; /**< Protects the pointer to the pool. */
+    std::atomic<std::size_t> numberOfThreads{defaultNumberOfThreads()};
+    std::shared_ptr<OsqpEigen::ThreadPool> pool; /**< Shared with the running calls. */
+};
+
+MatrixThreadPool& matrixThreadPool()
+{
+    static MatrixThreadPool instance;
+    return instance;
+}
+#endif
+} // namespace
+
+void OsqpEigen::SparseMatrixHelper::setNumberOfThreads(std::size_t numberOfThreads)
+{
+#ifdef OSQP_EIGEN_PARALLEL_MATRIX_CONSTRUCTION
+    MatrixThreadPool& threadPool = matrixThreadPool();
+    std::lock_guard<std::mutex> lock(threadPool.mutex);
+    threadPool.numberOfThreads
+        = std::min(std::max<std::size_t>(numberOfThreads, 1), maximumNumberOfParallelThreads);
+
+    // the pool is created again by the next parallel call, the running calls keep the old one
+    if (threadPool.pool
+        && (threadPool.pool->getNumberOfThreads() + 1 != threadPool.numberOfThreads))
+    {
+        threadPool.pool.reset();
+    }
+#else
+    if (numberOfThreads > 1)
+    {
+        OSQP_EIGEN_LOG_WARNING("[OsqpEigen::SparseMatrixHelper::setNumberOfThreads] The parallel "
+                               "path is disabled. Please compile the library with the "
+                               "OSQP_EIGEN_PARALLEL_MATRIX_CONSTRUCTION CMake option.");
+    }
+#endif
+}
+
+std::size_t OsqpEigen::SparseMatrixHelper::getNumberOfThreads()
+{
+#ifdef OSQP_EIGEN_PARALLEL_MATRIX_CONSTRUCTION
+    return matrixThreadPool().numberOfThreads;
+#else
+    return 1;
+#endif
+}
+
+void OsqpEigen::SparseMatrixHelper::detail::parallelFor(
+    std::size_t numberOfTasks, const std::function<void(std::size_t)>& task)
+{
+#ifdef OSQP_EIGEN_PARALLEL_MATRIX_CONSTRUCTION
+    std::shared_ptr<OsqpEigen::ThreadPool> pool;
+    {
+        MatrixThreadPool& threadPool = matrixThreadPool();
+        std::lock_guard<std::mutex> lock(threadPool.mutex);
+        if (!threadPool.pool && (threadPool.numberOfThreads > 1))
+        {
+            // the calling thread runs the tasks as well
+            threadPool.pool
+                = std::make_shared<OsqpEigen::ThreadPool>(threadPool.numberOfThreads - 1);
+        }
+        pool = threadPool.pool;
+    }
+
+    if (pool && pool->tryParallelFor(numberOfTasks, task))
+    {
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < numberOfTasks; i++)
+    {
+        task(i);
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ * @file ThreadPool.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// OsqpEigen
+#include <OsqpEigen/ThreadPool.hpp>
+
+OsqpEigen::ThreadPool::ThreadPool(std::size_t numberOfThreads)
+    : m_task(nullptr)
+    , m_numberOfTasks(0)
+    , m_nextTask(0)
+    , m_numberOfActiveWorkers(0)
+    , m_generation(0)
+    , m_stop(false)
+{
+    m_threads.reserve(numberOfThreads);
+    for (std::size_t i = 0; i < numberOfThreads; i++)
+    {
+        m_threads.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+OsqpEigen::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_taskCondition.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+std::size_t OsqpEigen::ThreadPool::getNumberOfThreads() const
+{
+    return m_threads.size();
+}
+
+void OsqpEigen::ThreadPool::runTasks()
+{
+    for (std::size_t i = m_nextTask.fetch_add(1); i < m_numberOfTasks; i = m_nextTask.fetch_add(1))
+    {
+        (*m_task)(i);
+    }
+}
+
+void OsqpEigen::ThreadPool::workerLoop()
+{
+    std::size_t generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskCondition.wait(lock, [&] { return m_stop || (m_generation != generation); });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_numberOfActiveWorkers--;
+        }
+        m_doneCondition.notify_one();
+    }
+}
+
+void OsqpEigen::ThreadPool::parallelFor(std::size_t numberOfTasks,
+                                        const std::function<void(std::size_t)>& task)
+{
+    std::lock_guard<std::mutex> parallelForLock(m_parallelForMutex);
+    runParallelFor(numberOfTasks, task);
+}
+
+bool OsqpEigen::ThreadPool::tryParallelFor(std::size_t numberOfTasks,
+                                           const std::function<void(std::size_t)>& task)
+{
+    std::unique_lock<std::mutex> parallelForLock(m_parallelForMutex, std::try_to_lock);
+    if (!parallelForLock.owns_lock())
+    {
+        return false;
+    }
+    runParallelFor(numberOfTasks, task);
+    return true;
+}
+
+void OsqpEigen::ThreadPool::runParallelFor(std::size_t numberOfTasks,
+                                           const std::function<void(std::size_t)>& task)
+{
+    // if there are no workers the tasks are run by the calling thread
+    if (m_threads.empty() || (numberOfTasks <= 1))
+    {
+        for (std::size_t i = 0; i < numberOfTasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_numberOfTasks = numberOfTasks;
+        m_nextTask = 0;
+        m_numberOfActiveWorkers = m_threads.size();
+        m_generation++;
+    }
+    m_taskCondition.notify_all();
+
+    // the calling thread contributes to the execution of the tasks
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [&] { return m_numberOfActiveWorkers == 0; });
+    m_task = nullptr;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file AsyncSolveTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <OsqpEigen/OsqpEigen.h>
+
+#include "TestProblem.hpp"
+
+#include <functional>
+#include <future>
+#include <stdexcept>
+
+namespace
+{
+// the problem is updated while the completion callback is running, hence the update is issued
+// after the solve and before the future is ready
+OsqpEigen::ErrorExitFlag solveAndUpdate(OsqpEigen::Solver& solver,
+                                        const std::function<bool()>& update)
+{
+    std::promise<void> isSolved;
+    std::promise<void> isUpdated;
+    std::future<void> isUpdatedFuture = isUpdated.get_future();
+    std::future<OsqpEigen::ErrorExitFlag> future
+        = solver.solveAsync([&](OsqpEigen::ErrorExitFlag) {
+              isSolved.set_value();
+              isUpdatedFuture.wait();
+          });
+
+    isSolved.get_future().wait();
+    const bool isUpdateSuccessful = update();
+    isUpdated.set_value();
+    const OsqpEigen::ErrorExitFlag exitFlag = future.get();
+    return isUpdateSuccessful ? exitFlag : OsqpEigen::ErrorExitFlag::DataValidationError;
+}
+} // namespace
+
+TEST_CASE("AsyncSolve")
+{
+    constexpr double tolerance = 1e-3;
+
+    OsqpEigenTest::TestProblem problem;
+
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setAbsoluteTolerance(1e-6);
+    solver.settings()->setRelativeTolerance(1e-6);
+
+    REQUIRE(solver.solveAsync().get() == OsqpEigen::ErrorExitFlag::WorkspaceNotInitError);
+
+    REQUIRE(problem.setData(solver.data()));
+    REQUIRE(solver.initSolver());
+
+    // the worker is pinned when it is started
+    REQUIRE(solver.setAsyncWorkerCpuAffinity(0));
+
+    // the bounds updated while the solve is pending are used by the next solve
+    Eigen::Matrix<c_float, 3, 1> newUpperBound;
+    newUpperBound << 1, 0.7, 0.6;
+    REQUIRE(solveAndUpdate(solver,
+                           [&] { return solver.updateBounds(problem.lowerBound, newUpperBound); })
+            == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    expectedSolution << 0.4, 0.6;
+    REQUIRE(solver.solveAsync().get() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // the solves are run in the order they are submitted and the updates queued between them
+    // are applied before the next one
+    std::future<OsqpEigen::ErrorExitFlag> firstFuture = solver.solveAsync();
+    REQUIRE(solver.updateBounds(problem.lowerBound, problem.upperBound));
+    std::future<OsqpEigen::ErrorExitFlag> secondFuture = solver.solveAsync();
+    REQUIRE(firstFuture.get() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(secondFuture.get() == OsqpEigen::ErrorExitFlag::NoError);
+    expectedSolution << 0.3, 0.7;
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // the updates queued during the last asynchronous solve are applied by solveProblem()
+    REQUIRE(solveAndUpdate(solver, [&] { return solver.updateUpperBound(newUpperBound); })
+            == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    expectedSolution << 0.4, 0.6;
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // the bounds are checked when they are queued, the rejected ones are not sent to the
+    // workspace and the queued upper bound is used by the next solve
+    Eigen::Matrix<c_float, 3, 1> invalidLowerBound;
+    invalidLowerBound << 1, 0, 0.8;
+    REQUIRE(solveAndUpdate(solver,
+                           [&] {
+                               return !solver.updateBounds(invalidLowerBound, newUpperBound)
+                                      && solver.updateUpperBound(problem.upperBound)
+                                      && !solver.updateLowerBound(invalidLowerBound);
+                           })
+            == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.solveAsync().get() == OsqpEigen::ErrorExitFlag::NoError);
+    expectedSolution << 0.3, 0.7;
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // an exception thrown by the completion callback is forwarded to the future, the worker keeps
+    // running the next solves
+    REQUIRE_THROWS_AS(solver
+                          .solveAsync([](OsqpEigen::ErrorExitFlag) {
+                              throw std::runtime_error("completion callback");
+                          })
+                          .get(),
+                      std::runtime_error);
+    REQUIRE(solver.solveAsync().get() == OsqpEigen::ErrorExitFlag::NoError);
+
+    // the completion callback can initialize the solver again, the worker is kept and it runs
+    // the next solves on the new workspace. The assertions are checked by the calling thread
+    Eigen::SparseMatrix<c_float> newH_s(2, 2);
+    newH_s.insert(0, 0) = 1;
+    newH_s.insert(1, 1) = 4;
+    bool isHessianUpdated = false;
+    REQUIRE(solver
+                .solveAsync([&](OsqpEigen::ErrorExitFlag) {
+                    isHessianUpdated = solver.updateHessianMatrix(newH_s);
+                })
+                .get()
+            == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(isHessianUpdated);
+    REQUIRE(solver.isInitialized());
+    REQUIRE(solver.solveAsync().get() == OsqpEigen::ErrorExitFlag::NoError);
+    expectedSolution << 0.7, 0.3;
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // the pending solves are completed when the solver is cleared
+    std::future<OsqpEigen::ErrorExitFlag> future = solver.solveAsync();
+    solver.clearSolver();
+    REQUIRE(future.get() == OsqpEigen::ErrorExitFlag::NoError);
+}
@@ -0,0 +1,148 @@
+/**
+ * @file BatchSolverTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <OsqpEigen/OsqpEigen.h>
+
+#include "TestProblem.hpp"
+
+TEST_CASE("BatchSolver")
+{
+    constexpr double tolerance = 1e-3;
+    constexpr int numberOfProblems = 16;
+
+    OsqpEigenTest::TestProblem problem;
+
+    OsqpEigen::BatchSolver batchSolver;
+    batchSolver.settings()->setVerbosity(false);
+    batchSolver.settings()->setAlpha(1.0);
+
+    REQUIRE(batchSolver.solveProblems() == OsqpEigen::ErrorExitFlag::WorkspaceNotInitError);
+
+    REQUIRE(problem.setData(batchSolver.data()));
+
+    REQUIRE(batchSolver.initSolver(numberOfProblems, 4));
+    REQUIRE(batchSolver.getNumberOfProblems() == numberOfProblems);
+
+    // each problem has a different gradient, bounds and matrices
+    Eigen::Matrix<c_float, -1, -1> gradients(2, numberOfProblems);
+    Eigen::Matrix<c_float, -1, -1> lowerBounds(3, numberOfProblems);
+    Eigen::Matrix<c_float, -1, -1> upperBounds(3, numberOfProblems);
+    Eigen::Matrix<c_float, -1, -1> hessianValues(3, numberOfProblems);
+    Eigen::Matrix<c_float, -1, -1> linearConstraintsValues(4, numberOfProblems);
+    for (int k = 0; k < numberOfProblems; k++)
+    {
+        gradients.col(k) << 1 + 0.1 * k, 1 - 0.1 * k;
+        lowerBounds.col(k) << 1, 0, 0;
+        upperBounds.col(k) << 1, 0.7 + 0.01 * k, 0.7;
+        hessianValues.col(k) << 4 + k, 1, 2;
+        linearConstraintsValues.col(k) << 1, 1, 1, 1;
+    }
+
+    // the size of the matrices is checked
+    REQUIRE_FALSE(batchSolver.updateGradients(gradients.leftCols(numberOfProblems - 1)));
+    REQUIRE_FALSE(batchSolver.updateBounds(upperBounds, lowerBounds.topRows(2)));
+
+    REQUIRE(batchSolver.updateGradients(gradients));
+    REQUIRE(batchSolver.updateBounds(lowerBounds, upperBounds));
+    REQUIRE(batchSolver.updateHessianValues(hessianValues));
+    REQUIRE(batchSolver.updateLinearConstraintsValues(linearConstraintsValues));
+    REQUIRE(batchSolver.solveProblems() == OsqpEigen::ErrorExitFlag::NoError);
+
+    REQUIRE(batchSolver.getSolutions().rows() == 2);
+    REQUIRE(batchSolver.getSolutions().cols() == numberOfProblems);
+    REQUIRE(batchSolver.getDualSolutions().rows() == 3);
+
+    // the solutions are compared with the ones of a single solver
+    for (int k = 0; k < numberOfProblems; k++)
+    {
+        Eigen::Matrix<c_float, 2, 2> H;
+        H << 4 + k, 1, 1, 2;
+        Eigen::SparseMatrix<c_float> hessian = H.sparseView();
+        Eigen::Matrix<c_float, 2, 1> problemGradient = gradients.col(k);
+        Eigen::Matrix<c_float, 3, 1> problemLowerBound = lowerBounds.col(k);
+        Eigen::Matrix<c_float, 3, 1> problemUpperBound = upperBounds.col(k);
+
+        OsqpEigen::Solver solver;
+        solver.settings()->setVerbosity(false);
+        solver.settings()->setAlpha(1.0);
+        solver.data()->setNumberOfVariables(2);
+        solver.data()->setNumberOfConstraints(3);
+        REQUIRE(solver.data()->setHessianMatrix(hessian));
+        REQUIRE(solver.data()->setGradient(problemGradient));
+        REQUIRE(solver.data()->setLinearConstraintsMatrix(problem.linearConstraints));
+        REQUIRE(solver.data()->setLowerBound(problemLowerBound));
+        REQUIRE(solver.data()->setUpperBound(problemUpperBound));
+        REQUIRE(solver.initSolver());
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+        REQUIRE(batchSolver.getStatus()[k] == solver.getStatus());
+        REQUIRE((batchSolver.getSolutions().col(k) - solver.getSolution()).norm() <= tolerance);
+    }
+}
+
+TEST_CASE("BatchSolver - Failed updates")
+{
+    constexpr double tolerance = 1e-3;
+    constexpr int numberOfProblems = 4;
+
+    Eigen::SparseMatrix<c_float> H_s(2, 2);
+    H_s.insert(0, 0) = 1;
+    H_s.insert(1, 1) = 1;
+
+    Eigen::SparseMatrix<c_float> A_s(2, 2);
+    A_s.insert(0, 0) = 1;
+    A_s.insert(1, 1) = 1;
+
+    Eigen::Matrix<c_float, 2, 1> gradient;
+    gradient << -1, -1;
+
+    Eigen::Matrix<c_float, 2, 1> lowerBound;
+    lowerBound << -2, -2;
+
+    Eigen::Matrix<c_float, 2, 1> upperBound;
+    upperBound << 2, 2;
+
+    OsqpEigen::BatchSolver batchSolver;
+    batchSolver.settings()->setVerbosity(false);
+    batchSolver.data()->setNumberOfVariables(2);
+    batchSolver.data()->setNumberOfConstraints(2);
+    REQUIRE(batchSolver.data()->setHessianMatrix(H_s));
+    REQUIRE(batchSolver.data()->setGradient(gradient));
+    REQUIRE(batchSolver.data()->setLinearConstraintsMatrix(A_s));
+    REQUIRE(batchSolver.data()->setBounds(lowerBound, upperBound));
+    REQUIRE(batchSolver.initSolver(numberOfProblems, 2));
+
+    // the lower bound of the first problem is greater than its upper bound, hence osqp rejects
+    // the new bounds of that problem only
+    Eigen::Matrix<c_float, -1, -1> lowerBounds = lowerBound.replicate(1, numberOfProblems);
+    Eigen::Matrix<c_float, -1, -1> upperBounds(2, numberOfProblems);
+    upperBounds.setConstant(0.5);
+    lowerBounds(0, 0) = 1;
+    REQUIRE(batchSolver.updateBounds(lowerBounds, upperBounds));
+    REQUIRE(batchSolver.solveProblems() == OsqpEigen::ErrorExitFlag::DataValidationError);
+    REQUIRE(batchSolver.getErrorExitFlags()[0] == OsqpEigen::ErrorExitFlag::DataValidationError);
+
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.5, 0.5;
+    for (int k = 1; k < numberOfProblems; k++)
+    {
+        REQUIRE(batchSolver.getErrorExitFlags()[k] == OsqpEigen::ErrorExitFlag::NoError);
+        REQUIRE((batchSolver.getSolutions().col(k) - expectedSolution).norm() <= tolerance);
+    }
+
+    // the rejected bounds are sent again, hence the first problem is not solved with the old ones
+    REQUIRE(batchSolver.solveProblems() == OsqpEigen::ErrorExitFlag::DataValidationError);
+    REQUIRE(batchSolver.getErrorExitFlags()[0] == OsqpEigen::ErrorExitFlag::DataValidationError);
+
+    // the problem is solved once its bounds are replaced by valid ones
+    lowerBounds(0, 0) = -2;
+    REQUIRE(batchSolver.updateBounds(lowerBounds, upperBounds));
+    REQUIRE(batchSolver.solveProblems() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE((batchSolver.getSolutions().col(0) - expectedSolution).norm() <= tolerance);
+}
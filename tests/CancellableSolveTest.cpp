@@ -0,0 +1,124 @@
+/**
+ * @file CancellableSolveTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <OsqpEigen/OsqpEigen.h>
+
+#include "TestProblem.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace
+{
+constexpr double tolerance = 1e-3;
+} // namespace
+
+TEST_CASE("Solver - Cancellable solve")
+{
+    OsqpEigenTest::TestProblem problem;
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setAbsoluteTolerance(1e-6);
+    solver.settings()->setRelativeTolerance(1e-6);
+    REQUIRE(problem.setData(solver.data()));
+    REQUIRE(solver.initSolver());
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    const Eigen::Matrix<c_float, -1, 1> solution = solver.getSolution();
+    const Eigen::Matrix<c_float, -1, 1> dualSolution = solver.getDualSolution();
+
+    // a cancelled solve does not run any iteration, the solution of the previous solve is the
+    // best available one and it is kept
+    std::atomic<bool> cancel(true);
+    REQUIRE(solver.solveProblem(cancel) == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.getStatus() == OsqpEigen::Status::Sigint);
+    REQUIRE(solver.getSolution() == solution);
+    REQUIRE(solver.getDualSolution() == dualSolution);
+
+    cancel = false;
+    REQUIRE(solver.solveProblem(cancel) == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // the iterations are split in chunks, the limit on the total number is preserved
+    OsqpEigen::Solver limitedSolver;
+    limitedSolver.settings()->setVerbosity(false);
+    limitedSolver.settings()->setWarmStart(false);
+    limitedSolver.settings()->setAbsoluteTolerance(1e-12);
+    limitedSolver.settings()->setRelativeTolerance(1e-12);
+    limitedSolver.settings()->setMaxIteration(60);
+    REQUIRE(problem.setData(limitedSolver.data()));
+    REQUIRE(limitedSolver.initSolver());
+    REQUIRE(limitedSolver.solveProblem(cancel) == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(limitedSolver.getStatus() == OsqpEigen::Status::MaxIterReached);
+
+    // the automatic rho interval is replaced only during the chunks
+    OsqpEigen::Solver automaticRhoSolver;
+    automaticRhoSolver.settings()->setVerbosity(false);
+    automaticRhoSolver.settings()->setAbsoluteTolerance(1e-6);
+    automaticRhoSolver.settings()->setRelativeTolerance(1e-6);
+    automaticRhoSolver.settings()->setAdaptiveRhoInterval(0);
+    REQUIRE(problem.setData(automaticRhoSolver.data()));
+    REQUIRE(automaticRhoSolver.initSolver());
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+    const OSQPSettings* settings = automaticRhoSolver.solver()->settings;
+#else
+    const OSQPSettings* settings = automaticRhoSolver.workspace()->settings;
+#endif
+    const c_int adaptiveRhoInterval = settings->adaptive_rho_interval;
+    REQUIRE(automaticRhoSolver.solveProblem(cancel) == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(automaticRhoSolver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((automaticRhoSolver.getSolution() - expectedSolution).norm() <= tolerance);
+    REQUIRE(settings->adaptive_rho_interval == adaptiveRhoInterval);
+}
+
+TEST_CASE("Solver - Solve with deadline")
+{
+    OsqpEigenTest::TestProblem problem;
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setAbsoluteTolerance(1e-6);
+    solver.settings()->setRelativeTolerance(1e-6);
+    REQUIRE(problem.setData(solver.data()));
+    REQUIRE(solver.initSolver());
+
+    // no iteration is run after the deadline
+    const auto now = std::chrono::steady_clock::now();
+    REQUIRE(solver.solveProblem(now) == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.getStatus() == OsqpEigen::Status::TimeLimitReached);
+
+    std::atomic<bool> cancel(true);
+    REQUIRE(solver.solveProblem(now + std::chrono::hours(1), &cancel)
+            == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.getStatus() == OsqpEigen::Status::Sigint);
+
+    cancel = false;
+    REQUIRE(solver.solveProblem(now + std::chrono::hours(1), &cancel)
+            == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // the solution of a solve that does not converge is an iterate
+    OsqpEigen::Solver limitedSolver;
+    limitedSolver.settings()->setVerbosity(false);
+    limitedSolver.settings()->setAbsoluteTolerance(1e-12);
+    limitedSolver.settings()->setRelativeTolerance(1e-12);
+    limitedSolver.settings()->setMaxIteration(50);
+    REQUIRE(problem.setData(limitedSolver.data()));
+    REQUIRE(limitedSolver.initSolver());
+    REQUIRE(limitedSolver.solveProblem(std::chrono::steady_clock::now() + std::chrono::hours(1))
+            == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(limitedSolver.getStatus() == OsqpEigen::Status::MaxIterReached);
+    REQUIRE((limitedSolver.getSolution() - expectedSolution).norm() <= tolerance);
+}
@@ -0,0 +1,151 @@
+/**
+ * @file EventTraceTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+#include "TestProblem.hpp"
+
+// eigen
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+TEST_CASE("EventTrace - Ring buffer")
+{
+    OsqpEigen::EventRingBuffer buffer(5);
+    REQUIRE(buffer.capacity() == 8);
+
+    SECTION("First in first out")
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            OsqpEigen::SolverEvent event;
+            event.beginTime = i;
+            REQUIRE(buffer.push(event));
+        }
+
+        // the buffer is full
+        REQUIRE_FALSE(buffer.push(OsqpEigen::SolverEvent()));
+        REQUIRE(buffer.droppedEvents() == 1);
+
+        OsqpEigen::SolverEvent event;
+        REQUIRE(buffer.pop(event));
+        REQUIRE(event.beginTime == 0);
+        REQUIRE(buffer.push(event));
+
+        std::vector<OsqpEigen::SolverEvent> events;
+        REQUIRE(buffer.drain(events) == 8);
+        for (int i = 0; i < 7; i++)
+        {
+            REQUIRE(events[i].beginTime == i + 1);
+        }
+        REQUIRE(events[7].beginTime == 0);
+        REQUIRE_FALSE(buffer.pop(event));
+    }
+
+    SECTION("Concurrent producers")
+    {
+        constexpr int numberOfThreads = 4;
+        constexpr int eventsPerThread = 1000;
+        OsqpEigen::EventRingBuffer largeBuffer(numberOfThreads * eventsPerThread);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numberOfThreads; t++)
+        {
+            threads.emplace_back([&largeBuffer, t]() {
+                for (int i = 0; i < eventsPerThread; i++)
+                {
+                    OsqpEigen::SolverEvent event;
+                    event.beginTime = t * eventsPerThread + i;
+                    largeBuffer.push(event);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::vector<OsqpEigen::SolverEvent> events;
+        REQUIRE(largeBuffer.drain(events) == numberOfThreads * eventsPerThread);
+        REQUIRE(largeBuffer.droppedEvents() == 0);
+
+        std::vector<std::int64_t> times;
+        for (const auto& event : events)
+        {
+            times.push_back(event.beginTime);
+        }
+        std::sort(times.begin(), times.end());
+        for (int i = 0; i < numberOfThreads * eventsPerThread; i++)
+        {
+            REQUIRE(times[i] == i);
+        }
+    }
+}
+
+TEST_CASE("EventTrace - Solver events")
+{
+    OsqpEigenTest::TestProblem problem;
+
+    auto buffer = std::make_shared<OsqpEigen::EventRingBuffer>(16);
+
+    OsqpEigen::Solver solver;
+    solver.setEventRingBuffer(buffer);
+    solver.settings()->setVerbosity(false);
+    REQUIRE(problem.setData(solver.data()));
+    REQUIRE(solver.initSolver());
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    // a change of the sparsity pattern reinitializes the solver
+    Eigen::Matrix<c_float, 2, 2> H;
+    H << 4, 0, 0, 2;
+    const Eigen::SparseMatrix<c_float> diagonalHessian = H.sparseView();
+    REQUIRE(solver.updateHessianMatrix(diagonalHessian));
+
+    // the initialization fails since the solver is already initialized
+    REQUIRE_FALSE(solver.initSolver());
+
+    std::vector<OsqpEigen::SolverEvent> events;
+    REQUIRE(buffer->drain(events) == 5);
+
+    REQUIRE(events[0].type == OsqpEigen::SolverEventType::InitSolver);
+    REQUIRE(events[0].exitFlag == 0);
+    REQUIRE(events[1].type == OsqpEigen::SolverEventType::SolveProblem);
+    REQUIRE(events[1].exitFlag == static_cast<int>(OsqpEigen::ErrorExitFlag::NoError));
+    REQUIRE(events[1].status == static_cast<int>(OsqpEigen::Status::Solved));
+    REQUIRE(events[1].endTime >= events[1].beginTime);
+
+    // the nested initialization ends before the reinitialization
+    REQUIRE(events[2].type == OsqpEigen::SolverEventType::InitSolver);
+    REQUIRE(events[3].type == OsqpEigen::SolverEventType::HessianReinitialization);
+    REQUIRE(events[3].exitFlag == 0);
+    REQUIRE(events[4].type == OsqpEigen::SolverEventType::InitSolver);
+    REQUIRE(events[4].exitFlag == -1);
+
+    for (const auto& event : events)
+    {
+        REQUIRE(event.solver == reinterpret_cast<std::uintptr_t>(&solver));
+    }
+
+    std::ostringstream trace;
+    REQUIRE(OsqpEigen::writeChromeTrace(events, trace));
+    REQUIRE(trace.str().find("\"name\":\"hessianReinitialization\"") != std::string::npos);
+    REQUIRE(trace.str().find("\"ph\":\"X\"") != std::string::npos);
+
+    std::ostringstream csv;
+    REQUIRE(OsqpEigen::writeCsv(events, csv));
+    const std::string csvString = csv.str();
+    REQUIRE(std::count(csvString.begin(), csvString.end(), '\n') == 6);
+    REQUIRE(csvString.find("solveProblem,") != std::string::npos);
+}
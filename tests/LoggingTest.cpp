@@ -0,0 +1,131 @@
+/**
+ * @file LoggingTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class RecordingSink : public OsqpEigen::LogSink
+{
+    std::mutex m_mutex;
+    std::vector<std::pair<OsqpEigen::LogLevel, std::string>> m_messages;
+
+public:
+    void write(OsqpEigen::LogLevel level, const char* message) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_messages.emplace_back(level, message);
+    }
+
+    std::vector<std::pair<OsqpEigen::LogLevel, std::string>> messages()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_messages;
+    }
+};
+
+TEST_CASE("Logging")
+{
+    auto sink = std::make_shared<RecordingSink>();
+    OsqpEigen::Logging::setSink(sink);
+    OsqpEigen::Logging::setLevel(OsqpEigen::LogLevel::Debug);
+
+    SECTION("Formatting")
+    {
+        const std::string name = "solver";
+        OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Info,
+                       "[" << name << "] " << 3 << " x " << 4u << " " << 0.5 << ' ' << -2);
+        OsqpEigen::Logging::flush();
+
+        const auto messages = sink->messages();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].first == OsqpEigen::LogLevel::Info);
+        REQUIRE(messages[0].second == "[solver] 3 x 4 0.5 -2");
+    }
+
+    SECTION("Level filtering")
+    {
+        OsqpEigen::Logging::setLevel(OsqpEigen::LogLevel::Warning);
+        REQUIRE_FALSE(OsqpEigen::Logging::isLevelEnabled(OsqpEigen::LogLevel::Info));
+        REQUIRE(OsqpEigen::Logging::isLevelEnabled(OsqpEigen::LogLevel::Error));
+
+        OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Info, "discarded");
+        OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Error, "kept");
+        OsqpEigen::Logging::flush();
+
+        const auto messages = sink->messages();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].second == "kept");
+
+        OsqpEigen::Logging::setLevel(OsqpEigen::LogLevel::Off);
+        REQUIRE_FALSE(OsqpEigen::Logging::isLevelEnabled(OsqpEigen::LogLevel::Error));
+    }
+
+    SECTION("Truncation")
+    {
+        const std::string longMessage(2 * OsqpEigen::Logging::maxMessageLength, 'a');
+        OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Error, longMessage << "b");
+        OsqpEigen::Logging::flush();
+
+        const auto messages = sink->messages();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].second
+                == longMessage.substr(0, OsqpEigen::Logging::maxMessageLength - 1));
+    }
+
+    SECTION("Background thread")
+    {
+        // the thread is notified by the messages, hence they are written without flushing
+        REQUIRE(OsqpEigen::Logging::start());
+        OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Info, "written by the thread");
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (sink->messages().empty() && (std::chrono::steady_clock::now() < deadline))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(sink->messages().size() == 1);
+
+        // the messages logged while the thread is stopped are written when it is restarted
+        OsqpEigen::Logging::stop();
+        OSQP_EIGEN_LOG(OsqpEigen::LogLevel::Info, "queued");
+        REQUIRE(sink->messages().size() == 1);
+        REQUIRE(OsqpEigen::Logging::start());
+        OsqpEigen::Logging::stop();
+
+        const auto messages = sink->messages();
+        REQUIRE(messages.size() == 2);
+        REQUIRE(messages[1].second == "queued");
+        REQUIRE(OsqpEigen::Logging::start());
+    }
+
+#if OSQP_EIGEN_LOG_MIN_LEVEL <= 3
+    SECTION("Solver errors")
+    {
+        OsqpEigen::Solver solver;
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::WorkspaceNotInitError);
+        OsqpEigen::Logging::flush();
+
+        const auto messages = sink->messages();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages[0].first == OsqpEigen::LogLevel::Error);
+        REQUIRE(messages[0].second.find("[OsqpEigen::Solver::solveProblem]") == 0);
+    }
+#endif
+
+    OsqpEigen::Logging::setLevel(OsqpEigen::LogLevel::Debug);
+    OsqpEigen::Logging::setSink(std::make_shared<OsqpEigen::StreamLogSink>(std::cerr));
+}
@@ -0,0 +1,187 @@
+/**
+ * @file MPCProblemBuilderTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+// eigen
+#include <Eigen/Dense>
+
+#include <vector>
+
+namespace
+{
+constexpr int numberOfStates = 2;
+constexpr int numberOfInputs = 1;
+constexpr int horizon = 5;
+constexpr int numberOfVariables = numberOfStates * (horizon + 1) + numberOfInputs * horizon;
+constexpr int numberOfConstraints = numberOfStates * (horizon + 1) + numberOfVariables;
+
+// build the same problem with triplets, as done by the examples
+void buildReferenceProblem(const std::vector<Eigen::Matrix<c_float, 2, 2>>& A,
+                           const Eigen::Matrix<c_float, 2, 1>& B,
+                           const Eigen::Matrix<c_float, 2, 2>& Q,
+                           c_float R,
+                           Eigen::Matrix<c_float, -1, -1>& hessian,
+                           Eigen::Matrix<c_float, -1, -1>& linearMatrix)
+{
+    const int offset = numberOfStates * (horizon + 1);
+    hessian = Eigen::Matrix<c_float, -1, -1>::Zero(numberOfVariables, numberOfVariables);
+    linearMatrix = Eigen::Matrix<c_float, -1, -1>::Zero(numberOfConstraints, numberOfVariables);
+    for (int k = 0; k < horizon + 1; k++)
+    {
+        hessian.block<2, 2>(2 * k, 2 * k) = Q.triangularView<Eigen::Upper>();
+    }
+    for (int k = 0; k < horizon; k++)
+    {
+        hessian(offset + k, offset + k) = R;
+    }
+
+    linearMatrix.topLeftCorner(offset, offset)
+        = -Eigen::Matrix<c_float, -1, -1>::Identity(offset, offset);
+    for (int k = 0; k < horizon; k++)
+    {
+        linearMatrix.block<2, 2>(2 * (k + 1), 2 * k) = A[k];
+        linearMatrix.block<2, 1>(2 * (k + 1), offset + k) = B;
+    }
+    linearMatrix.bottomRows(numberOfVariables)
+        = Eigen::Matrix<c_float, -1, -1>::Identity(numberOfVariables, numberOfVariables);
+}
+} // namespace
+
+TEST_CASE("MPCProblemBuilder")
+{
+    std::vector<Eigen::Matrix<c_float, 2, 2>> A(horizon);
+    for (auto& stageA : A)
+    {
+        stageA << 1, 0.1, 0, 1;
+    }
+    Eigen::Matrix<c_float, 2, 1> B;
+    B << 0, 0.1;
+    Eigen::Matrix<c_float, 2, 2> Q;
+    Q << 2, 0.5, 0.5, 1;
+    Eigen::Matrix<c_float, 1, 1> R;
+    R << 0.1;
+
+    Eigen::Matrix<c_float, 2, 1> xMin, xMax, x0, xRef;
+    xMin << -10, -1;
+    xMax << 10, 1;
+    x0 << 0.5, 0;
+    xRef << 1, 0;
+    Eigen::Matrix<c_float, 1, 1> uMin, uMax;
+    uMin << -2;
+    uMax << 2;
+
+    OsqpEigen::MPCProblemBuilder builder(numberOfStates, numberOfInputs, horizon);
+    REQUIRE(builder.getNumberOfVariables() == numberOfVariables);
+    REQUIRE(builder.getNumberOfConstraints() == numberOfConstraints);
+    REQUIRE(builder.setDynamics(A[0], B));
+    REQUIRE(builder.setWeights(Q, R));
+    REQUIRE(builder.setStateBounds(xMin, xMax));
+    REQUIRE(builder.setInputBounds(uMin, uMax));
+    REQUIRE(builder.setInitialState(x0));
+    REQUIRE(builder.setStateReference(xRef));
+
+    SECTION("Structure")
+    {
+        Eigen::Matrix<c_float, -1, -1> hessian, linearMatrix;
+        buildReferenceProblem(A, B, Q, R(0), hessian, linearMatrix);
+
+        REQUIRE(builder.getHessianMatrix().isCompressed());
+        REQUIRE(builder.getLinearConstraintsMatrix().isCompressed());
+        REQUIRE(builder.getHessianMatrix().toDense().isApprox(hessian));
+        REQUIRE(builder.getLinearConstraintsMatrix().toDense().isApprox(linearMatrix));
+
+        // the gradient is -Q xRef for each state
+        for (int k = 0; k < horizon + 1; k++)
+        {
+            REQUIRE(builder.getGradient().segment<2>(2 * k).isApprox(-Q * xRef));
+        }
+        REQUIRE(builder.getGradient().tail<horizon>().isZero());
+
+        REQUIRE(builder.getLowerBound().head<2>().isApprox(-x0));
+        REQUIRE(builder.getUpperBound().head<2>().isApprox(-x0));
+        REQUIRE(builder.getLowerBound().tail<horizon>().isApprox(
+            Eigen::Matrix<c_float, horizon, 1>::Constant(uMin(0))));
+
+        // wrong sizes and stages are rejected
+        REQUIRE_FALSE(builder.setStageDynamics(horizon, A[0], B));
+        REQUIRE_FALSE(builder.setStageDynamics(0, B, B));
+        REQUIRE_FALSE(builder.setStageStateWeight(horizon + 1, Q));
+        REQUIRE(builder.setStageStateWeight(horizon, Q));
+    }
+
+    SECTION("Stage update")
+    {
+        const c_float* hessianValues = builder.getHessianMatrix().valuePtr();
+        const c_float* linearValues = builder.getLinearConstraintsMatrix().valuePtr();
+        const auto linearNonZeros = builder.getLinearConstraintsMatrix().nonZeros();
+
+        A[2] << 1, 0.2, -0.1, 1;
+        REQUIRE(builder.setStageDynamics(2, A[2], B));
+        Eigen::Matrix<c_float, 2, 2> terminalQ = 10 * Q;
+        REQUIRE(builder.setStageStateWeight(horizon, terminalQ));
+
+        // the values are changed in place
+        REQUIRE(builder.getHessianMatrix().valuePtr() == hessianValues);
+        REQUIRE(builder.getLinearConstraintsMatrix().valuePtr() == linearValues);
+        REQUIRE(builder.getLinearConstraintsMatrix().nonZeros() == linearNonZeros);
+
+        Eigen::Matrix<c_float, -1, -1> hessian, linearMatrix;
+        buildReferenceProblem(A, B, Q, R(0), hessian, linearMatrix);
+        hessian.bottomRightCorner<horizon + 2, horizon + 2>().topLeftCorner<2, 2>()
+            = terminalQ.triangularView<Eigen::Upper>();
+        REQUIRE(builder.getLinearConstraintsMatrix().toDense().isApprox(linearMatrix));
+        REQUIRE(builder.getHessianMatrix().toDense().isApprox(hessian));
+        REQUIRE(builder.getGradient().segment<2>(2 * horizon).isApprox(-terminalQ * xRef));
+    }
+
+    SECTION("Solver")
+    {
+        OsqpEigen::Solver solver;
+        solver.settings()->setVerbosity(false);
+        solver.settings()->setAbsoluteTolerance(1e-8);
+        solver.settings()->setRelativeTolerance(1e-8);
+        REQUIRE(builder.setSolverData(*solver.data()));
+        REQUIRE(solver.initSolver());
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+        // update a stage and send only the new values
+        A[3] << 1, 0.2, -0.1, 1;
+        REQUIRE(builder.setStageDynamics(3, A[3], B));
+        REQUIRE(solver.updateLinearConstraintsValues(builder.getLinearConstraintsValues()));
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+        // the solution is the same of a solver initialized with the new problem
+        OsqpEigen::Solver referenceSolver;
+        referenceSolver.settings()->setVerbosity(false);
+        referenceSolver.settings()->setAbsoluteTolerance(1e-8);
+        referenceSolver.settings()->setRelativeTolerance(1e-8);
+        Eigen::Matrix<c_float, -1, 1> gradient = builder.getGradient();
+        Eigen::Matrix<c_float, -1, 1> lowerBound = builder.getLowerBound();
+        Eigen::Matrix<c_float, -1, 1> upperBound = builder.getUpperBound();
+        Eigen::SparseMatrix<c_float> hessian = builder.getHessianMatrix();
+        Eigen::SparseMatrix<c_float> linearMatrix = builder.getLinearConstraintsMatrix();
+        referenceSolver.data()->setNumberOfVariables(numberOfVariables);
+        referenceSolver.data()->setNumberOfConstraints(numberOfConstraints);
+        REQUIRE(referenceSolver.data()->setHessianMatrix(hessian));
+        REQUIRE(referenceSolver.data()->setGradient(gradient));
+        REQUIRE(referenceSolver.data()->setLinearConstraintsMatrix(linearMatrix));
+        REQUIRE(referenceSolver.data()->setBounds(lowerBound, upperBound));
+        REQUIRE(referenceSolver.initSolver());
+        REQUIRE(referenceSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+        REQUIRE(solver.getSolution().isApprox(referenceSolver.getSolution(), 1e-4));
+
+        // the blocks of the builder describe the whole problem
+        REQUIRE(solver.warmStartShifted(builder.getPrimalStageBlocks(),
+                                        builder.getDualStageBlocks()));
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    }
+}
@@ -14,9 +14,12 @@
 // eigen
 #include <Eigen/Dense>
 
+#include "TestProblem.hpp"
+
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 // colors
 #define ANSI_TXT_GRN "\033[0;32m"
@@ -274,6 +277,7 @@ TEST_CASE("MPCTest")
     // settings
     solver.settings()->setVerbosity(false);
     solver.settings()->setWarmStart(true);
+    solver.settings()->setSigma(OsqpEigenTest::sigma);
 
     // set the initial data of the QP solver
     solver.data()->setNumberOfVariables(12 * (mpcWindow + 1) + 4 * mpcWindow);
@@ -336,3 +340,103 @@ TEST_CASE("MPCTest")
     constexpr double tolerance = 1e-2;
     REQUIRE(getErrorNorm(x0, xRef) <= tolerance);
 }
+
+enum class WarmStartType
+{
+    Cold,
+    Unshifted,
+    Shifted
+};
+
+c_int solveClosedLoop(WarmStartType warmStartType)
+{
+    constexpr int mpcWindow = 20;
+    constexpr int numberOfSteps = 30;
+
+    Eigen::Matrix<c_float, 12, 12> a;
+    Eigen::Matrix<c_float, 12, 4> b;
+    Eigen::Matrix<c_float, 12, 1> xMax, xMin;
+    Eigen::Matrix<c_float, 4, 1> uMax, uMin;
+    Eigen::DiagonalMatrix<c_float, 12> Q;
+    Eigen::DiagonalMatrix<c_float, 4> R;
+    Eigen::Matrix<c_float, 12, 1> x0 = Eigen::Matrix<c_float, 12, 1>::Zero();
+    Eigen::Matrix<c_float, 12, 1> xRef = Eigen::Matrix<c_float, 12, 1>::Zero();
+    xRef(2) = 1;
+
+    setDynamicsMatrices(a, b);
+    setInequalityConstraints(xMax, xMin, uMax, uMin);
+    setWeightMatrices(Q, R);
+
+    Eigen::SparseMatrix<c_float> hessian, linearMatrix;
+    Eigen::Matrix<c_float, -1, 1> gradient, lowerBound, upperBound;
+    castMPCToQPHessian(Q, R, mpcWindow, hessian);
+    castMPCToQPGradient(Q, xRef, mpcWindow, gradient);
+    castMPCToQPConstraintMatrix(a, b, mpcWindow, linearMatrix);
+    castMPCToQPConstraintVectors(xMax, xMin, uMax, uMin, x0, mpcWindow, lowerBound, upperBound);
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setWarmStart(warmStartType != WarmStartType::Cold);
+    solver.settings()->setSigma(OsqpEigenTest::sigma);
+
+    // the termination is checked at every iteration, hence the iterations are counted exactly
+    solver.settings()->setCheckTermination(1);
+    solver.data()->setNumberOfVariables(12 * (mpcWindow + 1) + 4 * mpcWindow);
+    solver.data()->setNumberOfConstraints(2 * 12 * (mpcWindow + 1) + 4 * mpcWindow);
+    REQUIRE(solver.data()->setHessianMatrix(hessian));
+    REQUIRE(solver.data()->setGradient(gradient));
+    REQUIRE(solver.data()->setLinearConstraintsMatrix(linearMatrix));
+    REQUIRE(solver.data()->setBounds(lowerBound, upperBound));
+    REQUIRE(solver.initSolver());
+
+    // the variables are the states and the inputs of each stage, the constraints are the
+    // dynamics and the bounds of the states and of the inputs
+    const std::vector<OsqpEigen::StageBlock> primalStageBlocks = {{mpcWindow + 1, 12},
+                                                                  {mpcWindow, 4}};
+    const std::vector<OsqpEigen::StageBlock> dualStageBlocks = {{mpcWindow + 1, 12},
+                                                                {mpcWindow + 1, 12},
+                                                                {mpcWindow, 4}};
+
+    c_int iterations = 0;
+    for (int i = 0; i < numberOfSteps; i++)
+    {
+        if ((warmStartType == WarmStartType::Shifted) && (i > 0))
+        {
+            REQUIRE(solver.warmStartShifted(primalStageBlocks, dualStageBlocks));
+        }
+
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+        // the first problem is solved from the same initial guess in all the cases
+        if (i > 0)
+        {
+#ifdef OSQP_EIGEN_OSQP_IS_V1
+            iterations += solver.solver()->info->iter;
+#else
+            iterations += solver.workspace()->info->iter;
+#endif
+        }
+
+        const Eigen::Matrix<c_float, 4, 1> ctr
+            = solver.solutionView().segment<4>(12 * (mpcWindow + 1));
+        x0 = a * x0 + b * ctr;
+        updateConstraintVectors(x0, lowerBound, upperBound);
+        REQUIRE(solver.updateBounds(lowerBound, upperBound));
+    }
+
+    return iterations;
+}
+
+TEST_CASE("MPCTest - Shifted warm start")
+{
+    const c_int coldStartIterations = solveClosedLoop(WarmStartType::Cold);
+    const c_int unshiftedIterations = solveClosedLoop(WarmStartType::Unshifted);
+    const c_int shiftedIterations = solveClosedLoop(WarmStartType::Shifted);
+
+    std::cout << COUT_GTEST_MGT << "ADMM iterations: cold start = " << coldStartIterations
+              << ", warm start = " << unshiftedIterations
+              << ", shifted warm start = " << shiftedIterations << ANSI_TXT_DFT << std::endl;
+
+    REQUIRE(shiftedIterations < coldStartIterations);
+    REQUIRE(shiftedIterations < unshiftedIterations);
+}
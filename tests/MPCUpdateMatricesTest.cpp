@@ -14,9 +14,12 @@
 // eigen
 #include <Eigen/Dense>
 
+#include "TestProblem.hpp"
+
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <type_traits>
 
 // colors
 #define ANSI_TXT_GRN "\033[0;32m"
@@ -251,6 +254,7 @@ TEST_CASE("MPCTest Update matrices")
     // settings
     solver.settings()->setVerbosity(false);
     solver.settings()->setWarmStart(true);
+    solver.settings()->setSigma(OsqpEigenTest::sigma);
 
     // set the initial data of the QP solver
     solver.data()->setNumberOfVariables(2 * (mpcWindow + 1) + 1 * mpcWindow);
@@ -319,3 +323,78 @@ TEST_CASE("MPCTest Update matrices")
     std::cout << COUT_GTEST_MGT << "Average time = " << averageTime / numberOfSteps << " seconds."
               << ANSI_TXT_DFT << std::endl;
 }
+
+TEST_CASE("MPCTest Update matrices - column major and row major")
+{
+    // set the preview window
+    int mpcWindow = 100;
+
+    // allocate the weight matrices
+    Eigen::DiagonalMatrix<c_float, 1> Q;
+    Eigen::DiagonalMatrix<c_float, 1> R;
+
+    // allocate the initial and the reference state space
+    Eigen::Matrix<c_float, 2, 1> x0;
+    Eigen::Matrix<c_float, 1, 1> yRef;
+
+    // allocate QP problem matrices and vectors
+    Eigen::SparseMatrix<c_float> hessian;
+    Eigen::Matrix<c_float, -1, 1> gradient;
+    Eigen::SparseMatrix<c_float> linearMatrix;
+    Eigen::Matrix<c_float, -1, 1> lowerBound;
+    Eigen::Matrix<c_float, -1, 1> upperBound;
+
+    x0 << 0, 0;
+    yRef << 1;
+    setWeightMatrices(Q, R);
+
+    castMPCToQPHessian(Q, R, mpcWindow, 0, hessian);
+    castMPCToQPGradient(Q, yRef, mpcWindow, 0, gradient);
+    castMPCToQPConstraintMatrix(mpcWindow, 0, linearMatrix);
+    castMPCToQPConstraintVectors(x0, mpcWindow, lowerBound, upperBound);
+
+    // the column major matrices are compared with the cached sparsity pattern while the row major
+    // ones are converted into triplets
+    OsqpEigen::Solver columnMajorSolver;
+    OsqpEigen::Solver rowMajorSolver;
+    for (OsqpEigen::Solver* solver : {&columnMajorSolver, &rowMajorSolver})
+    {
+        solver->settings()->setVerbosity(false);
+        solver->settings()->setWarmStart(true);
+        solver->settings()->setSigma(OsqpEigenTest::sigma);
+        solver->data()->setNumberOfVariables(2 * (mpcWindow + 1) + 1 * mpcWindow);
+        solver->data()->setNumberOfConstraints(2 * (mpcWindow + 1));
+        REQUIRE(solver->data()->setHessianMatrix(hessian));
+        REQUIRE(solver->data()->setGradient(gradient));
+        REQUIRE(solver->data()->setLinearConstraintsMatrix(linearMatrix));
+        REQUIRE(solver->data()->setLowerBound(lowerBound));
+        REQUIRE(solver->data()->setUpperBound(upperBound));
+        REQUIRE(solver->initSolver());
+    }
+
+    // number of iteration steps
+    int numberOfSteps = 50;
+
+    std::vector<Eigen::SparseMatrix<c_float, Eigen::ColMajor>> columnMajorMatrices(numberOfSteps);
+    std::vector<Eigen::SparseMatrix<c_float, Eigen::RowMajor>> rowMajorMatrices(numberOfSteps);
+    for (int i = 0; i < numberOfSteps; i++)
+    {
+        castMPCToQPConstraintMatrix(mpcWindow, i, columnMajorMatrices[i]);
+        columnMajorMatrices[i].makeCompressed();
+        rowMajorMatrices[i] = columnMajorMatrices[i];
+    }
+
+    for (int i = 0; i < numberOfSteps; i++)
+    {
+        REQUIRE(columnMajorSolver.updateLinearConstraintsMatrix(columnMajorMatrices[i]));
+        REQUIRE(rowMajorSolver.updateLinearConstraintsMatrix(rowMajorMatrices[i]));
+    }
+
+    // both the solvers have to solve the same problem
+    REQUIRE(columnMajorSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(rowMajorSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    // the solvers stop at the same tolerance but their rounding errors differ
+    constexpr double tolerance = std::is_same<c_float, float>::value ? 1e-2 : 1e-3;
+    REQUIRE((columnMajorSolver.getSolution() - rowMajorSolver.getSolution()).norm() <= tolerance);
+}
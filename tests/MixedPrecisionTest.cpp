@@ -0,0 +1,73 @@
+/**
+ * @file MixedPrecisionTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+// eigen
+#include <Eigen/Dense>
+
+#include <type_traits>
+
+#include "TestProblem.hpp"
+
+// the scalar type not used by OSQP, i.e. float if OSQP is compiled in double precision and
+// double otherwise
+using OtherScalar = std::conditional<std::is_same<c_float, double>::value, float, double>::type;
+
+TEST_CASE("MixedPrecision")
+{
+    constexpr double tolerance = 1e-3;
+
+    OsqpEigenTest::TestProblem problem;
+    Eigen::Matrix<OtherScalar, 2, 1> gradient = problem.gradient.cast<OtherScalar>();
+    Eigen::Matrix<OtherScalar, 3, 1> lowerBound = problem.lowerBound.cast<OtherScalar>();
+    Eigen::Matrix<OtherScalar, 3, 1> upperBound = problem.upperBound.cast<OtherScalar>();
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setAbsoluteTolerance(1e-5);
+    solver.settings()->setRelativeTolerance(1e-5);
+    solver.data()->setNumberOfVariables(2);
+    solver.data()->setNumberOfConstraints(3);
+    REQUIRE(solver.data()->setHessianMatrix(problem.hessian));
+    REQUIRE(solver.data()->setLinearConstraintsMatrix(problem.linearConstraints));
+
+    // the vectors are converted once, hence the temporaries can be destroyed
+    REQUIRE(solver.data()->setGradient(Eigen::Matrix<OtherScalar, 2, 1>(gradient)));
+    REQUIRE(solver.data()->setBounds(lowerBound, upperBound));
+    REQUIRE_FALSE(solver.data()->setLowerBound(Eigen::Matrix<OtherScalar, 2, 1>::Zero()));
+    REQUIRE(solver.initSolver());
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    Eigen::Matrix<OtherScalar, 2, 1> solution;
+    Eigen::Matrix<OtherScalar, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+    REQUIRE(solver.copySolutionTo(solution));
+    REQUIRE(solution.isApprox(expectedSolution, static_cast<OtherScalar>(tolerance)));
+
+    Eigen::Matrix<OtherScalar, 3, 1> dualSolution;
+    Eigen::Matrix<OtherScalar, 2, 1> wrongSizeDualSolution;
+    REQUIRE(solver.copyDualSolutionTo(dualSolution));
+    REQUIRE(dualSolution.isApprox(solver.dualSolutionView().cast<OtherScalar>()));
+    REQUIRE_FALSE(solver.copyDualSolutionTo(wrongSizeDualSolution));
+
+    // the updates are converted in the buffers of the solver
+    gradient << 2, 1;
+    upperBound << 1, 0.6, 0.6;
+    lowerBound << 1, 0.4, 0.4;
+    REQUIRE(solver.updateGradient(gradient));
+    REQUIRE(solver.updateBounds(lowerBound, upperBound));
+    REQUIRE_FALSE(solver.updateUpperBound(Eigen::Matrix<OtherScalar, 2, 1>::Zero()));
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    expectedSolution << 0.4, 0.6;
+    REQUIRE(solver.copySolutionTo(solution));
+    REQUIRE(solution.isApprox(expectedSolution, static_cast<OtherScalar>(tolerance)));
+}
@@ -0,0 +1,248 @@
+/**
+ * @file ParallelMatrixTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct ConversionResult
+{
+    std::vector<c_int> outerIndex;
+    std::vector<c_int> innerIndex;
+    std::vector<c_float> values;
+    std::vector<Eigen::Triplet<c_float>> osqpTriplets;
+    std::vector<Eigen::Triplet<c_float>> eigenTriplets;
+    bool isPatternEqual;
+    std::vector<c_int> changedIndices;
+    std::vector<c_float> changedValues;
+};
+
+// columns with a different number of non zeros, so that the ranges are not trivially balanced
+Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> buildMatrix(bool compressed)
+{
+    constexpr int rows = 1000;
+    constexpr int cols = 600;
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> matrix(rows, cols);
+    matrix.reserve(Eigen::VectorXi::Constant(cols, 300));
+    for (int j = 0; j < cols; j++)
+    {
+        for (int i = j % 7; i < rows; i += 1 + j % 5)
+        {
+            matrix.insert(i, j) = static_cast<c_float>(i - j) / 10;
+        }
+    }
+
+    if (compressed)
+    {
+        matrix.makeCompressed();
+    }
+    return matrix;
+}
+
+ConversionResult convert(const Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int>& matrix)
+{
+    ConversionResult result;
+    csc* osqpMatrix = nullptr;
+    REQUIRE(OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(matrix, osqpMatrix));
+    const c_int nnz = osqpMatrix->p[osqpMatrix->n];
+    REQUIRE(nnz >= OsqpEigen::SparseMatrixHelper::parallelMinimumNonZeros);
+
+    result.outerIndex.assign(osqpMatrix->p, osqpMatrix->p + osqpMatrix->n + 1);
+    result.innerIndex.assign(osqpMatrix->i, osqpMatrix->i + nnz);
+    result.values.assign(osqpMatrix->x, osqpMatrix->x + nnz);
+    REQUIRE(OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(osqpMatrix,
+                                                                      result.osqpTriplets));
+    REQUIRE(OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(matrix,
+                                                                       result.eigenTriplets));
+
+    // the last inner index is changed, hence all the ranges but the last one are equal
+    std::vector<c_int> otherInnerIndex = result.innerIndex;
+    otherInnerIndex.back()++;
+    result.isPatternEqual
+        = OsqpEigen::SparseMatrixHelper::isSparsityPatternEqual(osqpMatrix->n,
+                                                                osqpMatrix->p,
+                                                                osqpMatrix->i,
+                                                                result.outerIndex.data(),
+                                                                otherInnerIndex.data());
+
+    // some values are changed in each range
+    std::vector<c_float> newValues = result.values;
+    for (std::size_t k = 0; k < newValues.size(); k += 997)
+    {
+        newValues[k] += 1;
+    }
+    OsqpEigen::SparseMatrixHelper::evaluateChangedValues(nnz,
+                                                         osqpMatrix->x,
+                                                         newValues.data(),
+                                                         result.changedIndices,
+                                                         result.changedValues);
+
+    OsqpEigen::spfree(osqpMatrix);
+    return result;
+}
+
+bool areTripletsEqual(const std::vector<Eigen::Triplet<c_float>>& triplets,
+                      const std::vector<Eigen::Triplet<c_float>>& otherTriplets)
+{
+    if (triplets.size() != otherTriplets.size())
+    {
+        return false;
+    }
+
+    for (std::size_t k = 0; k < triplets.size(); k++)
+    {
+        if (triplets[k].row() != otherTriplets[k].row()
+            || triplets[k].col() != otherTriplets[k].col()
+            || triplets[k].value() != otherTriplets[k].value())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("ParallelMatrix")
+{
+    const std::size_t defaultNumberOfThreads = OsqpEigen::SparseMatrixHelper::getNumberOfThreads();
+
+    for (bool compressed : {true, false})
+    {
+        const auto matrix = buildMatrix(compressed);
+
+        OsqpEigen::SparseMatrixHelper::setNumberOfThreads(1);
+        REQUIRE(OsqpEigen::SparseMatrixHelper::getNumberOfThreads() == 1);
+        const ConversionResult sequential = convert(matrix);
+
+        OsqpEigen::SparseMatrixHelper::setNumberOfThreads(4);
+        REQUIRE(OsqpEigen::SparseMatrixHelper::getNumberOfThreads() == 4);
+        const ConversionResult parallel = convert(matrix);
+
+        REQUIRE(parallel.outerIndex == sequential.outerIndex);
+        REQUIRE(parallel.innerIndex == sequential.innerIndex);
+        REQUIRE(parallel.values == sequential.values);
+        REQUIRE(areTripletsEqual(parallel.osqpTriplets, sequential.osqpTriplets));
+        REQUIRE(areTripletsEqual(parallel.eigenTriplets, sequential.eigenTriplets));
+        REQUIRE_FALSE(sequential.isPatternEqual);
+        REQUIRE_FALSE(parallel.isPatternEqual);
+        REQUIRE(parallel.changedIndices == sequential.changedIndices);
+        REQUIRE(parallel.changedValues == sequential.changedValues);
+        REQUIRE(sequential.changedIndices.size() == (sequential.values.size() + 996) / 997);
+    }
+
+    // the number of threads is limited
+    OsqpEigen::SparseMatrixHelper::setNumberOfThreads(1000);
+    REQUIRE(OsqpEigen::SparseMatrixHelper::getNumberOfThreads()
+            == OsqpEigen::SparseMatrixHelper::maximumNumberOfParallelThreads);
+
+    OsqpEigen::SparseMatrixHelper::setNumberOfThreads(defaultNumberOfThreads);
+}
+
+TEST_CASE("ParallelMatrix - Upper triangular matrix")
+{
+    const std::size_t defaultNumberOfThreads = OsqpEigen::SparseMatrixHelper::getNumberOfThreads();
+
+    constexpr int size = 1000;
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> matrix(size, size);
+    matrix.reserve(Eigen::VectorXi::Constant(size, 400));
+    for (int j = 0; j < size; j++)
+    {
+        for (int i = j % 7; i < size; i += 1 + j % 5)
+        {
+            matrix.insert(i, j) = static_cast<c_float>(i - j) / 10;
+        }
+    }
+
+    for (bool compressed : {false, true})
+    {
+        if (compressed)
+        {
+            matrix.makeCompressed();
+        }
+
+        std::vector<std::vector<Eigen::Triplet<c_float>>> triplets;
+        for (std::size_t numberOfThreads : {1, 4})
+        {
+            OsqpEigen::SparseMatrixHelper::setNumberOfThreads(numberOfThreads);
+            csc* osqpMatrix = nullptr;
+            REQUIRE(OsqpEigen::SparseMatrixHelper::createOsqpUpperTriangularSparseMatrix(
+                matrix, osqpMatrix));
+            REQUIRE(osqpMatrix->p[size] >= OsqpEigen::SparseMatrixHelper::parallelMinimumNonZeros);
+            triplets.emplace_back();
+            REQUIRE(OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(osqpMatrix,
+                                                                              triplets.back()));
+            OsqpEigen::spfree(osqpMatrix);
+        }
+
+        REQUIRE(areTripletsEqual(triplets[0], triplets[1]));
+        bool isUpperTriangular = true;
+        for (const auto& triplet : triplets[1])
+        {
+            isUpperTriangular = isUpperTriangular && (triplet.row() <= triplet.col());
+        }
+        REQUIRE(isUpperTriangular);
+    }
+
+    OsqpEigen::SparseMatrixHelper::setNumberOfThreads(defaultNumberOfThreads);
+}
+
+TEST_CASE("ParallelMatrix - Concurrent calls")
+{
+    const std::size_t defaultNumberOfThreads = OsqpEigen::SparseMatrixHelper::getNumberOfThreads();
+    const auto matrix = buildMatrix(true);
+
+    OsqpEigen::SparseMatrixHelper::setNumberOfThreads(1);
+    const ConversionResult sequential = convert(matrix);
+
+    // the calls that find the threads busy process the matrix alone, the results do not change.
+    // The assertions are checked by the main thread only
+    OsqpEigen::SparseMatrixHelper::setNumberOfThreads(4);
+    std::vector<std::vector<Eigen::Triplet<c_float>>> triplets(4);
+    std::vector<int> isConverted(triplets.size(), 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < triplets.size(); t++)
+    {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 10; i++)
+            {
+                csc* osqpMatrix = nullptr;
+                if (!OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(matrix, osqpMatrix))
+                {
+                    return;
+                }
+                triplets[t].clear();
+                const bool isOk
+                    = OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToTriplets(osqpMatrix,
+                                                                                triplets[t]);
+                OsqpEigen::spfree(osqpMatrix);
+                if (!isOk)
+                {
+                    return;
+                }
+            }
+            isConverted[t] = 1;
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (std::size_t t = 0; t < triplets.size(); t++)
+    {
+        REQUIRE(isConverted[t] == 1);
+        REQUIRE(areTripletsEqual(triplets[t], sequential.osqpTriplets));
+    }
+
+    OsqpEigen::SparseMatrixHelper::setNumberOfThreads(defaultNumberOfThreads);
+}
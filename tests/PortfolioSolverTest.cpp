@@ -0,0 +1,131 @@
+/**
+ * @file PortfolioSolverTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <OsqpEigen/OsqpEigen.h>
+
+#include "TestProblem.hpp"
+
+namespace
+{
+constexpr double tolerance = 1e-3;
+} // namespace
+
+TEST_CASE("PortfolioSolver")
+{
+    OsqpEigenTest::TestProblem problem;
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+
+    OsqpEigen::PortfolioSolver portfolioSolver;
+    REQUIRE(portfolioSolver.solveProblem() == OsqpEigen::ErrorExitFlag::WorkspaceNotInitError);
+    REQUIRE(problem.setData(portfolioSolver.data()));
+
+    // at least a profile is required
+    REQUIRE_FALSE(portfolioSolver.initSolver());
+
+    // a grid of rho values
+    for (double rho : {1e-3, 1e-1, 1e1})
+    {
+        const auto& settings = portfolioSolver.addProfile();
+        settings->setVerbosity(false);
+        settings->setRho(rho);
+    }
+    REQUIRE(portfolioSolver.getNumberOfProfiles() == 3);
+    REQUIRE(portfolioSolver.settings(1)->getSettings()->rho == static_cast<c_float>(1e-1));
+
+    REQUIRE(portfolioSolver.initSolver());
+    REQUIRE(portfolioSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(portfolioSolver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE(portfolioSolver.getWinner() >= 0);
+    REQUIRE(portfolioSolver.getProfilesStatus()[portfolioSolver.getWinner()]
+            == OsqpEigen::Status::Solved);
+    REQUIRE((portfolioSolver.getSolution() - expectedSolution).norm() <= tolerance);
+    REQUIRE(portfolioSolver.getDualSolution().size() == 3);
+
+    // the new data are sent to all the profiles
+    Eigen::Matrix<c_float, 3, 1> upperBound;
+    upperBound << 1, 0.7, 0.6;
+    expectedSolution << 0.4, 0.6;
+    REQUIRE_FALSE(portfolioSolver.updateGradient(Eigen::Matrix<c_float, 3, 1>::Zero()));
+    REQUIRE(portfolioSolver.updateBounds(problem.lowerBound, upperBound));
+    REQUIRE(portfolioSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(portfolioSolver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((portfolioSolver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    portfolioSolver.clearSolver();
+    REQUIRE_FALSE(portfolioSolver.isInitialized());
+}
+
+TEST_CASE("PortfolioSolver - Failing profile")
+{
+    OsqpEigenTest::TestProblem problem;
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+
+    // the first profile cannot converge, hence the second one is the winner
+    OsqpEigen::PortfolioSolver portfolioSolver;
+    REQUIRE(problem.setData(portfolioSolver.data()));
+    const auto& limitedSettings = portfolioSolver.addProfile();
+    limitedSettings->setVerbosity(false);
+    limitedSettings->setMaxIteration(1);
+    const auto& settings = portfolioSolver.addProfile();
+    settings->setVerbosity(false);
+    settings->setAbsoluteTolerance(1e-6);
+    settings->setRelativeTolerance(1e-6);
+
+    for (int numberOfThreads : {1, 2})
+    {
+        REQUIRE(portfolioSolver.initSolver(numberOfThreads));
+        REQUIRE(portfolioSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+        REQUIRE(portfolioSolver.getWinner() == 1);
+        REQUIRE(portfolioSolver.getProfilesStatus()[0] != OsqpEigen::Status::Solved);
+        REQUIRE(portfolioSolver.getStatus() == OsqpEigen::Status::Solved);
+        REQUIRE((portfolioSolver.getSolution() - expectedSolution).norm() <= tolerance);
+        portfolioSolver.clearSolver();
+    }
+}
+
+TEST_CASE("PortfolioSolver - Failed updates")
+{
+    OsqpEigenTest::TestProblem problem;
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+
+    OsqpEigen::PortfolioSolver portfolioSolver;
+    REQUIRE(problem.setData(portfolioSolver.data()));
+    for (int k = 0; k < 2; k++)
+    {
+        const auto& settings = portfolioSolver.addProfile();
+        settings->setVerbosity(false);
+        settings->setAbsoluteTolerance(1e-6);
+        settings->setRelativeTolerance(1e-6);
+    }
+    REQUIRE(portfolioSolver.initSolver());
+
+    // osqp rejects the bounds since a lower bound is greater than the upper bound. The rejected
+    // bounds are sent again by the next call, hence the problem is not solved with the old ones
+    Eigen::Matrix<c_float, 3, 1> invalidLowerBound;
+    invalidLowerBound << 1, 0, 0.8;
+    REQUIRE(portfolioSolver.updateBounds(invalidLowerBound, problem.upperBound));
+    for (int i = 0; i < 2; i++)
+    {
+        REQUIRE(portfolioSolver.solveProblem() == OsqpEigen::ErrorExitFlag::DataValidationError);
+        REQUIRE(portfolioSolver.getWinner() == -1);
+        for (const auto& errorExitFlag : portfolioSolver.getErrorExitFlags())
+        {
+            REQUIRE(errorExitFlag == OsqpEigen::ErrorExitFlag::DataValidationError);
+        }
+    }
+
+    // the pending bounds are replaced by the update
+    REQUIRE(portfolioSolver.updateBounds(problem.lowerBound, problem.upperBound));
+    REQUIRE(portfolioSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(portfolioSolver.getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((portfolioSolver.getSolution() - expectedSolution).norm() <= tolerance);
+}
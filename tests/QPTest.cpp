@@ -41,6 +41,16 @@ TEST_CASE("QPProblem - Unconstrained")
     expectedSolution << -1.2500, 0.3750;
 
     REQUIRE(solver.getSolution().isApprox(expectedSolution, tolerance));
+
+    // the views point directly to the solution stored by osqp
+    REQUIRE(solver.solutionView().isApprox(expectedSolution, tolerance));
+    REQUIRE(solver.dualSolutionView().size() == 0);
+
+    Eigen::Matrix<c_float, 2, 1> solution;
+    Eigen::Matrix<c_float, 3, 1> wrongSizeSolution;
+    REQUIRE(solver.copySolutionTo(solution));
+    REQUIRE(solution.isApprox(expectedSolution, tolerance));
+    REQUIRE_FALSE(solver.copySolutionTo(wrongSizeSolution));
 }
 
 TEST_CASE("QPProblem")
@@ -92,3 +102,137 @@ TEST_CASE("QPProblem")
 
     REQUIRE(solver.getSolution().isApprox(expectedSolution, tolerance));
 }
+
+TEST_CASE("QPProblem - Borrowed matrices")
+{
+    constexpr double tolerance = 1e-3;
+
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> H_s(2, 2);
+    H_s.insert(0, 0) = 4;
+    H_s.insert(0, 1) = 1;
+    H_s.insert(1, 0) = 1;
+    H_s.insert(1, 1) = 2;
+
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> A_s(3, 2);
+    A_s.insert(0, 0) = 1;
+    A_s.insert(0, 1) = 1;
+    A_s.insert(1, 0) = 1;
+    A_s.insert(2, 1) = 1;
+
+    Eigen::Matrix<c_float, 2, 1> gradient;
+    gradient << 1, 1;
+
+    Eigen::Matrix<c_float, 3, 1> lowerBound;
+    lowerBound << 1, 0, 0;
+
+    Eigen::Matrix<c_float, 3, 1> upperBound;
+    upperBound << 1, 0.7, 0.7;
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setAlpha(1.0);
+    solver.settings()->setAbsoluteTolerance(1e-6);
+    solver.settings()->setRelativeTolerance(1e-6);
+    solver.data()->setNumberOfVariables(2);
+    solver.data()->setNumberOfConstraints(3);
+
+    // only compressed matrices and the upper triangular part of the hessian can be borrowed
+    REQUIRE_FALSE(solver.data()->borrowHessianMatrix(H_s));
+    H_s.makeCompressed();
+    REQUIRE_FALSE(solver.data()->borrowHessianMatrix(H_s));
+
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> H_upper
+        = H_s.triangularView<Eigen::Upper>();
+    A_s.makeCompressed();
+    REQUIRE(solver.data()->borrowHessianMatrix(H_upper));
+    REQUIRE(solver.data()->borrowLinearConstraintsMatrix(A_s));
+    REQUIRE(solver.data()->getData()->P->x == H_upper.valuePtr());
+    REQUIRE(solver.data()->getData()->A->x == A_s.valuePtr());
+    REQUIRE(solver.data()->setGradient(gradient));
+    REQUIRE(solver.data()->setBounds(lowerBound, upperBound));
+
+    REQUIRE(solver.initSolver());
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // a borrowed matrix can be replaced by an owned one
+    solver.data()->clearHessianMatrix();
+    REQUIRE(solver.data()->setHessianMatrix(H_s));
+
+    // the reallocation of a borrowed matrix is detected in every build type
+    solver.clearSolver();
+    A_s.insert(1, 1) = 1;
+    REQUIRE_FALSE(solver.data()->areBorrowedMatricesValid());
+    REQUIRE_FALSE(solver.initSolver());
+}
+
+TEST_CASE("QPProblem - Double buffered vectors")
+{
+    constexpr double tolerance = 1e-3;
+
+    Eigen::SparseMatrix<c_float> H_s(2, 2);
+    H_s.insert(0, 0) = 4;
+    H_s.insert(0, 1) = 1;
+    H_s.insert(1, 0) = 1;
+    H_s.insert(1, 1) = 2;
+
+    Eigen::SparseMatrix<c_float> A_s(3, 2);
+    A_s.insert(0, 0) = 1;
+    A_s.insert(0, 1) = 1;
+    A_s.insert(1, 0) = 1;
+    A_s.insert(2, 1) = 1;
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setAlpha(1.0);
+    solver.settings()->setAbsoluteTolerance(1e-6);
+    solver.settings()->setRelativeTolerance(1e-6);
+    solver.data()->setNumberOfVariables(2);
+    solver.data()->setNumberOfConstraints(3);
+    solver.data()->setVectorsCopy(true, true);
+    REQUIRE_FALSE(solver.updateVectorsFromData());
+
+    REQUIRE(solver.data()->setHessianMatrix(H_s));
+    REQUIRE(solver.data()->setLinearConstraintsMatrix(A_s));
+
+    // the vectors are copied, hence the ones passed to the setters can be modified
+    Eigen::Matrix<c_float, 2, 1> gradient;
+    Eigen::Matrix<c_float, 3, 1> lowerBound;
+    Eigen::Matrix<c_float, 3, 1> upperBound;
+    gradient << 1, 1;
+    lowerBound << 1, 0, 0;
+    upperBound << 1, 0.7, 0.7;
+    REQUIRE(solver.data()->setGradient(gradient));
+    REQUIRE(solver.data()->setBounds(lowerBound, upperBound));
+    gradient.setConstant(100);
+
+    // the back buffer is used by the solver only after the swap
+    REQUIRE_FALSE(solver.data()->isSet());
+    REQUIRE(solver.data()->swapVectorsBuffers());
+    REQUIRE(solver.data()->isSet());
+
+    REQUIRE(solver.initSolver());
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.3, 0.7;
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    // the next problem is prepared in the back buffer
+    gradient << -3, 1;
+    upperBound << 1, 0.5, 0.7;
+    REQUIRE(solver.data()->setGradient(gradient));
+    REQUIRE(solver.data()->setBounds(lowerBound, upperBound));
+    REQUIRE(solver.data()->getGradient()(0) == 1);
+    REQUIRE(solver.data()->getGradient()(1) == 1);
+
+    REQUIRE(solver.data()->swapVectorsBuffers());
+    REQUIRE(solver.updateVectorsFromData());
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    expectedSolution << 0.5, 0.5;
+    REQUIRE((solver.getSolution() - expectedSolution).norm() <= tolerance);
+}
@@ -0,0 +1,170 @@
+/**
+ * @file RealTimeTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+// eigen
+#include <Eigen/Dense>
+
+#include <cmath>
+
+constexpr int mpcWindow = 10;
+constexpr int numberOfStates = 2;
+constexpr int numberOfVariables = numberOfStates * (mpcWindow + 1) + mpcWindow;
+constexpr int numberOfConstraints = numberOfStates * (mpcWindow + 1) + numberOfVariables;
+constexpr double samplingTime = 0.1;
+
+// the values of the matrices change at each step while their sparsity pattern is constant
+c_float stateWeight(int step)
+{
+    return 10 + 5 * std::sin(0.1 * step);
+}
+
+c_float velocityGain(int step)
+{
+    return samplingTime * (1 + 0.1 * std::sin(0.2 * step));
+}
+
+void setHessianMatrix(int step, Eigen::SparseMatrix<c_float>& hessian)
+{
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        hessian.coeffRef(i, i) = (i < numberOfStates * (mpcWindow + 1)) ? stateWeight(step) : 1;
+    }
+}
+
+void setLinearConstraintsMatrix(int step, Eigen::SparseMatrix<c_float>& linearMatrix)
+{
+    // x_{k+1} = [1 dt; 0 1] x_k + [0; dt] u_k
+    for (int k = 0; k < mpcWindow + 1; k++)
+    {
+        linearMatrix.coeffRef(numberOfStates * k, numberOfStates * k) = -1;
+        linearMatrix.coeffRef(numberOfStates * k + 1, numberOfStates * k + 1) = -1;
+    }
+    for (int k = 0; k < mpcWindow; k++)
+    {
+        const int row = numberOfStates * (k + 1);
+        const int state = numberOfStates * k;
+        const int input = numberOfStates * (mpcWindow + 1) + k;
+        linearMatrix.coeffRef(row, state) = 1;
+        linearMatrix.coeffRef(row, state + 1) = velocityGain(step);
+        linearMatrix.coeffRef(row + 1, state + 1) = 1;
+        linearMatrix.coeffRef(row + 1, input) = samplingTime;
+    }
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        linearMatrix.coeffRef(numberOfStates * (mpcWindow + 1) + i, i) = 1;
+    }
+}
+
+TEST_CASE("RealTime - Steady state MPC iterations do not allocate")
+{
+    REQUIRE(OsqpEigen::RealTime::isAllocationTrackingEnabled());
+
+    Eigen::SparseMatrix<c_float> hessian(numberOfVariables, numberOfVariables);
+    Eigen::SparseMatrix<c_float> linearMatrix(numberOfConstraints, numberOfVariables);
+    setHessianMatrix(0, hessian);
+    setLinearConstraintsMatrix(0, linearMatrix);
+    hessian.makeCompressed();
+    linearMatrix.makeCompressed();
+
+    Eigen::Matrix<c_float, numberOfStates, 1> x0;
+    Eigen::Matrix<c_float, numberOfStates, 1> xRef;
+    x0 << 0, 0;
+    xRef << 1, 0;
+
+    Eigen::Matrix<c_float, -1, 1> gradient = Eigen::Matrix<c_float, -1, 1>::Zero(numberOfVariables);
+    Eigen::Matrix<c_float, -1, 1> lowerBound(numberOfConstraints);
+    Eigen::Matrix<c_float, -1, 1> upperBound(numberOfConstraints);
+    lowerBound.setZero();
+    upperBound.setZero();
+    lowerBound.tail(numberOfVariables).setConstant(-10);
+    upperBound.tail(numberOfVariables).setConstant(10);
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.settings()->setWarmStart(true);
+    solver.setRealTimeMode(true);
+    REQUIRE(solver.isRealTimeModeEnabled());
+
+    solver.data()->setNumberOfVariables(numberOfVariables);
+    solver.data()->setNumberOfConstraints(numberOfConstraints);
+    REQUIRE(solver.data()->setHessianMatrix(hessian));
+    REQUIRE(solver.data()->setGradient(gradient));
+    REQUIRE(solver.data()->setLinearConstraintsMatrix(linearMatrix));
+    REQUIRE(solver.data()->setBounds(lowerBound, upperBound));
+    REQUIRE(solver.initSolver());
+
+    Eigen::Matrix<c_float, -1, 1> solution(numberOfVariables);
+    Eigen::Matrix<c_float, -1, 1> dualSolution(numberOfConstraints);
+
+    for (int step = 0; step < 50; step++)
+    {
+        // the problem is prepared outside the hot path
+        setHessianMatrix(step, hessian);
+        setLinearConstraintsMatrix(step, linearMatrix);
+        for (int k = 0; k < mpcWindow + 1; k++)
+        {
+            gradient.segment<numberOfStates>(numberOfStates * k) = -stateWeight(step) * xRef;
+        }
+        lowerBound.head<numberOfStates>() = -x0;
+        upperBound.head<numberOfStates>() = -x0;
+
+        OsqpEigen::RealTime::resetAllocationCount();
+
+        REQUIRE(solver.updateHessianMatrix(hessian));
+        REQUIRE(solver.updateLinearConstraintsMatrix(linearMatrix));
+        REQUIRE(solver.updateGradient(gradient));
+        REQUIRE(solver.updateBounds(lowerBound, upperBound));
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+        REQUIRE(solver.copySolutionTo(solution));
+        REQUIRE(solver.copyDualSolutionTo(dualSolution));
+
+        REQUIRE(OsqpEigen::RealTime::getAllocationCount() == 0);
+
+        // propagate the model with the first input
+        const c_float input = solution(numberOfStates * (mpcWindow + 1));
+        x0 << x0(0) + velocityGain(step) * x0(1), x0(1) + samplingTime * input;
+    }
+
+    // the state converges to the reference
+    REQUIRE((x0 - xRef).norm() < 0.1);
+
+    // a change of the sparsity pattern reinitializes the solver and it is reported
+    OsqpEigen::RealTime::resetAllocationCount();
+    hessian.coeffRef(0, 1) = 0.1;
+    hessian.coeffRef(1, 0) = 0.1;
+    REQUIRE(solver.updateHessianMatrix(hessian));
+    REQUIRE(OsqpEigen::RealTime::getAllocationCount() > 0);
+}
+
+#ifdef __GLIBC__
+TEST_CASE("RealTime - Dense Eigen temporaries in the hot path are counted")
+{
+    REQUIRE(OsqpEigen::RealTime::isAllocationTrackingEnabled());
+
+    const Eigen::Matrix<c_float, -1, -1> factor = Eigen::Matrix<c_float, -1, -1>::Random(20, 20);
+    Eigen::Matrix<c_float, -1, -1> product = Eigen::Matrix<c_float, -1, -1>::Identity(20, 20);
+
+    // the product is evaluated in a heap allocated temporary since it may alias the result
+    OsqpEigen::RealTime::resetAllocationCount();
+    {
+        const OsqpEigen::RealTime::HotPathScope scope;
+        product = product * factor;
+    }
+    REQUIRE(OsqpEigen::RealTime::getAllocationCount() > 0);
+    REQUIRE(product.isApprox(factor));
+
+    // the allocations outside the hot path are not counted
+    OsqpEigen::RealTime::resetAllocationCount();
+    product = product * factor;
+    REQUIRE(OsqpEigen::RealTime::getAllocationCount() == 0);
+}
+#endif
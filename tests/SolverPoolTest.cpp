@@ -0,0 +1,218 @@
+/**
+ * @file SolverPoolTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <OsqpEigen/OsqpEigen.h>
+
+#include "TestProblem.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr double tolerance = 1e-3;
+
+std::unique_ptr<OsqpEigen::Solver> createSolver(OsqpEigenTest::TestProblem& problem)
+{
+    auto solver = std::make_unique<OsqpEigen::Solver>();
+    solver->settings()->setVerbosity(false);
+    solver->settings()->setAbsoluteTolerance(1e-6);
+    solver->settings()->setRelativeTolerance(1e-6);
+    REQUIRE(problem.setData(solver->data()));
+    REQUIRE(solver->initSolver());
+    return solver;
+}
+} // namespace
+
+TEST_CASE("SolverPool - Key")
+{
+    OsqpEigenTest::TestProblem problem;
+    const OsqpEigen::SolverPool::Key key
+        = OsqpEigen::SolverPool::computeKey(problem.hessian, problem.linearConstraints);
+    REQUIRE(key.numberOfVariables == 2);
+    REQUIRE(key.numberOfConstraints == 3);
+
+    // the key of a solver depends only on the sparsity patterns
+    auto solver = createSolver(problem);
+    REQUIRE(OsqpEigen::SolverPool::computeKey(*solver) == key);
+
+    Eigen::SparseMatrix<c_float> hessian = problem.hessian;
+    hessian.coeffRef(0, 0) = 10;
+    REQUIRE(OsqpEigen::SolverPool::computeKey(hessian, problem.linearConstraints) == key);
+
+    // only the upper triangular part of the hessian is considered
+    hessian = problem.hessian.triangularView<Eigen::Upper>();
+    REQUIRE(OsqpEigen::SolverPool::computeKey(hessian, problem.linearConstraints) == key);
+
+    Eigen::SparseMatrix<c_float> linearConstraints = problem.linearConstraints;
+    linearConstraints.insert(2, 0) = 1;
+    REQUIRE_FALSE(OsqpEigen::SolverPool::computeKey(problem.hessian, linearConstraints) == key);
+
+    // the patterns are compared even if the hashes are equal
+    OsqpEigen::SolverPool::Key collidingKey = key;
+    collidingKey.linearConstraintsInnerIndex.back() = 0;
+    REQUIRE(OsqpEigen::SolverPool::KeyHash()(collidingKey)
+            == OsqpEigen::SolverPool::KeyHash()(key));
+    REQUIRE_FALSE(collidingKey == key);
+}
+
+TEST_CASE("SolverPool")
+{
+    OsqpEigenTest::TestProblem problem;
+    const OsqpEigen::SolverPool::Key key
+        = OsqpEigen::SolverPool::computeKey(problem.hessian, problem.linearConstraints);
+
+    OsqpEigen::SolverPool pool(1);
+    REQUIRE(pool.acquire(key) == nullptr);
+    REQUIRE_FALSE(pool.release(nullptr));
+    REQUIRE_FALSE(pool.release(std::make_unique<OsqpEigen::Solver>()));
+
+    auto solver = createSolver(problem);
+    REQUIRE(solver->solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    const OsqpEigen::Solver* releasedSolver = solver.get();
+    REQUIRE(pool.release(std::move(solver)));
+
+    // the solvers exceeding the maximum number are deallocated
+    REQUIRE_FALSE(pool.release(createSolver(problem)));
+    REQUIRE(pool.getNumberOfSolvers() == 1);
+    REQUIRE(pool.getNumberOfSolvers(key) == 1);
+
+    // the acquired solver needs only the update of the vectors
+    solver = pool.acquire(key);
+    REQUIRE(solver.get() == releasedSolver);
+    REQUIRE(solver->isInitialized());
+    REQUIRE(pool.getNumberOfSolvers() == 0);
+
+    // the solution of the previous problem is not used as warm start
+    Eigen::Matrix<c_float, Eigen::Dynamic, 1> primalVariable, dualVariable;
+    REQUIRE(solver->getPrimalVariable(primalVariable));
+    REQUIRE(solver->getDualVariable(dualVariable));
+    REQUIRE(primalVariable.isZero());
+    REQUIRE(dualVariable.isZero());
+
+    Eigen::Matrix<c_float, 3, 1> upperBound;
+    upperBound << 1, 0.7, 0.6;
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.4, 0.6;
+    REQUIRE(solver->updateBounds(problem.lowerBound, upperBound));
+    REQUIRE(solver->solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver->getStatus() == OsqpEigen::Status::Solved);
+    REQUIRE((solver->getSolution() - expectedSolution).norm() <= tolerance);
+
+    REQUIRE(pool.release(std::move(solver)));
+    pool.clear();
+    REQUIRE(pool.getNumberOfSolvers() == 0);
+}
+
+TEST_CASE("SolverPool - Borrowed matrices")
+{
+    OsqpEigenTest::TestProblem problem;
+    const OsqpEigen::SolverPool::Key key
+        = OsqpEigen::SolverPool::computeKey(problem.hessian, problem.linearConstraints);
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    solver.data()->setNumberOfVariables(2);
+    solver.data()->setNumberOfConstraints(3);
+    {
+        // the borrowed matrices are destroyed before the solver is released
+        Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> hessian
+            = problem.hessian.triangularView<Eigen::Upper>();
+        Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> linearConstraints
+            = problem.linearConstraints;
+        hessian.makeCompressed();
+        linearConstraints.makeCompressed();
+        REQUIRE(solver.data()->borrowHessianMatrix(hessian));
+        REQUIRE(solver.data()->borrowLinearConstraintsMatrix(linearConstraints));
+        REQUIRE(solver.data()->setGradient(problem.gradient));
+        REQUIRE(solver.data()->setBounds(problem.lowerBound, problem.upperBound));
+        REQUIRE(solver.initSolver());
+    }
+
+    // the key is computed from the sparsity patterns cached by the solver
+    REQUIRE(OsqpEigen::SolverPool::computeKey(solver) == key);
+}
+
+TEST_CASE("SolverPool - Detached data")
+{
+    auto problem = std::make_unique<OsqpEigenTest::TestProblem>();
+    const OsqpEigen::SolverPool::Key key
+        = OsqpEigen::SolverPool::computeKey(problem->hessian, problem->linearConstraints);
+
+    OsqpEigen::SolverPool pool;
+    REQUIRE(pool.release(createSolver(*problem)));
+
+    // the vectors and the matrices of the first owner are destroyed before the solver is
+    // reacquired
+    Eigen::SparseMatrix<c_float> hessian = problem->hessian;
+    problem.reset();
+
+    std::unique_ptr<OsqpEigen::Solver> solver = pool.acquire(key);
+    REQUIRE(solver != nullptr);
+    REQUIRE(solver->data()->areVectorsCopied());
+    REQUIRE(solver->updateVectorsFromData());
+
+    // a change of the sparsity pattern initializes the solver with the data copied in release()
+    hessian.coeffRef(0, 1) = 0;
+    hessian.coeffRef(1, 0) = 0;
+    hessian.prune(0.0);
+    REQUIRE(solver->updateHessianMatrix(hessian));
+    REQUIRE(solver->solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver->getStatus() == OsqpEigen::Status::Solved);
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 1.0 / 3, 2.0 / 3;
+    REQUIRE((solver->getSolution() - expectedSolution).norm() <= tolerance);
+}
+
+TEST_CASE("SolverPool - Concurrent access")
+{
+    OsqpEigenTest::TestProblem problem;
+    const OsqpEigen::SolverPool::Key key
+        = OsqpEigen::SolverPool::computeKey(problem.hessian, problem.linearConstraints);
+
+    OsqpEigen::SolverPool pool;
+    for (int i = 0; i < 2; i++)
+    {
+        REQUIRE(pool.release(createSolver(problem)));
+    }
+
+    // the threads share two solvers, hence an acquire may fail
+    std::vector<std::thread> threads;
+    std::vector<int> numberOfSolves(4, 0);
+    for (std::size_t t = 0; t < numberOfSolves.size(); t++)
+    {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 50; i++)
+            {
+                std::unique_ptr<OsqpEigen::Solver> solver = pool.acquire(key);
+                if (solver == nullptr)
+                {
+                    continue;
+                }
+                if (solver->solveProblem() == OsqpEigen::ErrorExitFlag::NoError)
+                {
+                    numberOfSolves[t]++;
+                }
+                pool.release(std::move(solver));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    int totalNumberOfSolves = 0;
+    for (int solves : numberOfSolves)
+    {
+        totalNumberOfSolves += solves;
+    }
+    REQUIRE(totalNumberOfSolves > 0);
+    REQUIRE(pool.getNumberOfSolvers(key) == 2);
+}
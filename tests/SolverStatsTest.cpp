@@ -0,0 +1,66 @@
+/**
+ * @file SolverStatsTest.cpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+#include "TestProblem.hpp"
+
+// eigen
+#include <Eigen/Dense>
+
+TEST_CASE("SolverStats - Update and solve phases")
+{
+    REQUIRE(OsqpEigen::SolverStats::isEnabled());
+
+    OsqpEigenTest::TestProblem problem;
+
+    OsqpEigen::Solver solver;
+    solver.settings()->setVerbosity(false);
+    REQUIRE(problem.setData(solver.data()));
+    REQUIRE(solver.initSolver());
+
+    REQUIRE(solver.stats().initialization.calls == 1);
+    REQUIRE(solver.stats().initialization.totalDuration > 0);
+
+    // the values of one element of each matrix change
+    problem.hessian.coeffRef(1, 1) = 3;
+    problem.linearConstraints.coeffRef(0, 0) = 2;
+    REQUIRE(solver.updateHessianMatrix(problem.hessian));
+    REQUIRE(solver.stats().lastChangedValues == 1);
+    REQUIRE(solver.updateLinearConstraintsMatrix(problem.linearConstraints));
+    REQUIRE(solver.stats().lastChangedValues == 1);
+    REQUIRE(solver.stats().totalChangedValues == 2);
+    REQUIRE(solver.stats().patternComparison.calls == 2);
+    REQUIRE(solver.stats().matrixUpdate.calls == 2);
+    REQUIRE(solver.stats().reinitialization.calls == 0);
+
+    REQUIRE(solver.updateBounds(problem.lowerBound, problem.upperBound));
+    REQUIRE(solver.updateGradient(problem.gradient));
+    REQUIRE(solver.stats().vectorUpdate.calls == 2);
+
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    REQUIRE(solver.stats().solve.calls == 1);
+    REQUIRE(solver.stats().iterations > 0);
+    REQUIRE(solver.stats().totalIterations
+            == static_cast<std::size_t>(solver.stats().iterations));
+    REQUIRE(solver.stats().solve.lastDuration > 0);
+
+    // a change of the sparsity pattern reinitializes the solver
+    Eigen::Matrix<c_float, 2, 2> H;
+    H << 4, 0, 0, 2;
+    const Eigen::SparseMatrix<c_float> diagonalHessian = H.sparseView();
+    REQUIRE(solver.updateHessianMatrix(diagonalHessian));
+    REQUIRE(solver.stats().reinitialization.calls == 1);
+    REQUIRE(solver.stats().initialization.calls == 2);
+
+    solver.resetStats();
+    REQUIRE(solver.stats().initialization.calls == 0);
+    REQUIRE(solver.stats().totalChangedValues == 0);
+}
@@ -11,6 +11,8 @@
 #include <OsqpEigen/OsqpEigen.h>
 #include <osqp.h>
 
+#include <algorithm>
+
 template <typename T, int n, int m> bool computeTest(const Eigen::Matrix<T, n, m>& mEigen)
 {
     Eigen::SparseMatrix<T, Eigen::ColMajor> matrix, newMatrix, newMatrixFromCSR;
@@ -97,4 +99,204 @@ TEST_CASE("SparseMatrix")
 
         REQUIRE(computeTest(m));
     }
+
+    SECTION("Uncompressed matrix")
+    {
+        Eigen::Matrix<double, 3, 4> m;
+        m << 1, 0, 2, 0, 0, 3, 0, 0, 4, 0, 0, 5;
+
+        Eigen::SparseMatrix<double, Eigen::ColMajor> colMajor(3, 4);
+        Eigen::SparseMatrix<double, Eigen::RowMajor> rowMajor(3, 4);
+        colMajor.reserve(Eigen::VectorXi::Constant(4, 2));
+        rowMajor.reserve(Eigen::VectorXi::Constant(3, 2));
+        for (int i = 0; i < m.rows(); i++)
+        {
+            for (int j = 0; j < m.cols(); j++)
+            {
+                if (m(i, j) != 0)
+                {
+                    colMajor.insert(i, j) = m(i, j);
+                    rowMajor.insert(i, j) = m(i, j);
+                }
+            }
+        }
+        REQUIRE_FALSE(colMajor.isCompressed());
+        REQUIRE_FALSE(rowMajor.isCompressed());
+
+        csc* colMajorOsqp = nullptr;
+        csc* rowMajorOsqp = nullptr;
+        REQUIRE(OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(colMajor, colMajorOsqp));
+        REQUIRE(OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(rowMajor, rowMajorOsqp));
+
+        Eigen::SparseMatrix<double> fromColMajor, fromRowMajor;
+        REQUIRE(OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToEigenSparseMatrix(colMajorOsqp,
+                                                                                   fromColMajor));
+        REQUIRE(OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToEigenSparseMatrix(rowMajorOsqp,
+                                                                                   fromRowMajor));
+        REQUIRE(Eigen::MatrixXd(fromColMajor).isApprox(m));
+        REQUIRE(Eigen::MatrixXd(fromRowMajor).isApprox(m));
+
+        OsqpEigen::spfree(colMajorOsqp);
+        OsqpEigen::spfree(rowMajorOsqp);
+    }
+}
+
+TEST_CASE("SparseMatrix - Comparison kernels")
+{
+    Eigen::Matrix<double, 4, 5> m;
+    m << 1, 0, 2, 0, 3, 0, 4, 0, 0, 5, 6, 0, 7, 8, 0, 0, 9, 0, 10, 11;
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> matrix = m.cast<c_float>().sparseView();
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, int> otherIndexMatrix = matrix;
+    matrix.makeCompressed();
+    otherIndexMatrix.makeCompressed();
+
+    const c_int cols = static_cast<c_int>(matrix.cols());
+    REQUIRE(OsqpEigen::SparseMatrixHelper::isSparsityPatternEqual(cols,
+                                                                  matrix.outerIndexPtr(),
+                                                                  matrix.innerIndexPtr(),
+                                                                  matrix.outerIndexPtr(),
+                                                                  matrix.innerIndexPtr()));
+    REQUIRE(
+        OsqpEigen::SparseMatrixHelper::isSparsityPatternEqual(cols,
+                                                              matrix.outerIndexPtr(),
+                                                              matrix.innerIndexPtr(),
+                                                              otherIndexMatrix.outerIndexPtr(),
+                                                              otherIndexMatrix.innerIndexPtr()));
+
+    // same number of non zeros, one element moved to another row
+    Eigen::Matrix<double, 4, 5> moved = m;
+    moved(3, 4) = 0;
+    moved(2, 4) = 11;
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> movedMatrix
+        = moved.cast<c_float>().sparseView();
+    movedMatrix.makeCompressed();
+    REQUIRE(movedMatrix.nonZeros() == matrix.nonZeros());
+    REQUIRE_FALSE(
+        OsqpEigen::SparseMatrixHelper::isSparsityPatternEqual(cols,
+                                                              matrix.outerIndexPtr(),
+                                                              matrix.innerIndexPtr(),
+                                                              movedMatrix.outerIndexPtr(),
+                                                              movedMatrix.innerIndexPtr()));
+
+    // the changed values are found both in the full blocks and in the remaining elements
+    std::vector<c_float> oldValues(19);
+    std::vector<double> newValues(19);
+    for (std::size_t i = 0; i < oldValues.size(); i++)
+    {
+        oldValues[i] = static_cast<c_float>(i);
+        newValues[i] = static_cast<double>(i);
+    }
+    newValues[0] = -1;
+    newValues[7] = -1;
+    newValues[10] = -1;
+    newValues[18] = -1;
+
+    std::vector<c_int> changedIndices;
+    std::vector<c_float> changedValues;
+    OsqpEigen::SparseMatrixHelper::evaluateChangedValues(static_cast<c_int>(oldValues.size()),
+                                                         oldValues.data(),
+                                                         newValues.data(),
+                                                         changedIndices,
+                                                         changedValues);
+    REQUIRE(changedIndices == std::vector<c_int>{0, 7, 10, 18});
+    REQUIRE(changedValues == std::vector<c_float>(4, -1));
+}
+
+TEST_CASE("SparseMatrix - Upper triangular part")
+{
+    Eigen::Matrix<double, 5, 5> m;
+    m << 1, 0, 2, 0, 3, 4, 5, 0, 0, 6, 0, 7, 0, 8, 0, 9, 0, 10, 11, 0, 0, 12, 0, 13, 14;
+    const Eigen::Matrix<double, 5, 5> upper = m.triangularView<Eigen::Upper>();
+
+    Eigen::SparseMatrix<double, Eigen::ColMajor> colMajor = m.sparseView();
+    Eigen::SparseMatrix<double, Eigen::RowMajor> rowMajor = m.sparseView();
+    Eigen::SparseMatrix<double, Eigen::ColMajor> uncompressedColMajor = colMajor;
+    Eigen::SparseMatrix<double, Eigen::RowMajor> uncompressedRowMajor = rowMajor;
+    uncompressedColMajor.uncompress();
+    uncompressedRowMajor.uncompress();
+    uncompressedColMajor.insert(4, 0) = 15;
+    uncompressedRowMajor.insert(4, 0) = 15;
+    REQUIRE_FALSE(uncompressedColMajor.isCompressed());
+    REQUIRE_FALSE(uncompressedRowMajor.isCompressed());
+
+    const auto requireUpperTriangular = [&](const auto& matrix) {
+        csc* osqpSparseMatrix = nullptr;
+        REQUIRE(OsqpEigen::SparseMatrixHelper::createOsqpUpperTriangularSparseMatrix(
+            matrix, osqpSparseMatrix));
+        REQUIRE(osqpSparseMatrix->p[osqpSparseMatrix->n] == 8);
+
+        Eigen::SparseMatrix<double> eigenSparseMatrix;
+        REQUIRE(OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToEigenSparseMatrix(
+            osqpSparseMatrix, eigenSparseMatrix));
+        REQUIRE(Eigen::MatrixXd(eigenSparseMatrix).isApprox(upper));
+        OsqpEigen::spfree(osqpSparseMatrix);
+    };
+
+    requireUpperTriangular(colMajor);
+    requireUpperTriangular(rowMajor);
+    requireUpperTriangular(uncompressedColMajor);
+    requireUpperTriangular(uncompressedRowMajor);
+
+    // only square matrices are accepted
+    Eigen::SparseMatrix<double> rectangular(3, 4);
+    csc* osqpSparseMatrix = nullptr;
+    REQUIRE_FALSE(OsqpEigen::SparseMatrixHelper::createOsqpUpperTriangularSparseMatrix(
+        rectangular, osqpSparseMatrix));
+    REQUIRE(osqpSparseMatrix == nullptr);
+
+    // an upper triangular matrix is copied as it is
+    Eigen::SparseMatrix<c_float> upperMatrix = upper.cast<c_float>().sparseView();
+    OsqpEigen::Data data(5, 1);
+    REQUIRE(data.setHessianMatrix(upperMatrix, true));
+    REQUIRE(data.getData()->P->p[5] == 8);
+    REQUIRE(std::equal(upperMatrix.valuePtr(),
+                       upperMatrix.valuePtr() + upperMatrix.nonZeros(),
+                       data.getData()->P->x));
+}
+
+TEST_CASE("SparseMatrix - Block of columns")
+{
+    Eigen::Matrix<double, 4, 4> m;
+    m << 1, 0, 0, 5, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4;
+    const Eigen::Matrix<double, 4, 2> expectedBlock = m.middleCols(2, 2);
+
+    // the outer indices of the block point into the arrays of the whole matrix, hence the first
+    // one is not zero
+    Eigen::SparseMatrix<c_float, Eigen::ColMajor, c_int> matrix = m.cast<c_float>().sparseView();
+    matrix.makeCompressed();
+    const auto block = matrix.middleCols(2, 2);
+    REQUIRE(block.isCompressed());
+    REQUIRE(block.outerIndexPtr()[0] == 2);
+
+    csc* osqpSparseMatrix = nullptr;
+    REQUIRE(OsqpEigen::SparseMatrixHelper::createOsqpSparseMatrix(block, osqpSparseMatrix));
+    REQUIRE(std::vector<c_int>(osqpSparseMatrix->p, osqpSparseMatrix->p + 3)
+            == std::vector<c_int>{0, 1, 3});
+    REQUIRE(std::vector<c_int>(osqpSparseMatrix->i, osqpSparseMatrix->i + 3)
+            == std::vector<c_int>{2, 0, 3});
+
+    Eigen::SparseMatrix<double> eigenSparseMatrix;
+    REQUIRE(OsqpEigen::SparseMatrixHelper::osqpSparseMatrixToEigenSparseMatrix(osqpSparseMatrix,
+                                                                               eigenSparseMatrix));
+    REQUIRE(Eigen::MatrixXd(eigenSparseMatrix).isApprox(expectedBlock));
+    OsqpEigen::spfree(osqpSparseMatrix);
+
+    // the triplets are stored in the order of the elements of the block
+    std::vector<Eigen::Triplet<double>> tripletList;
+    REQUIRE(OsqpEigen::SparseMatrixHelper::eigenSparseMatrixToTriplets(block, tripletList));
+    REQUIRE(tripletList.size() == 3);
+    REQUIRE(tripletList[0].row() == 2);
+    REQUIRE(tripletList[0].col() == 0);
+    REQUIRE(tripletList[1].row() == 0);
+    REQUIRE(tripletList[1].col() == 1);
+    REQUIRE(tripletList[2].row() == 3);
+    REQUIRE(tripletList[2].col() == 1);
+    REQUIRE(tripletList[2].value() == 4);
+
+    // the block is set as linear constraints matrix
+    OsqpEigen::Data data(2, 4);
+    REQUIRE(data.setLinearConstraintsMatrix(block));
+    REQUIRE(data.getData()->A->p[2] == 3);
+    REQUIRE(Eigen::Map<const Eigen::Matrix<c_float, 3, 1>>(data.getData()->A->x)
+            == Eigen::Matrix<c_float, 3, 1>(3, 5, 4));
 }
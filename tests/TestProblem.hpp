@@ -0,0 +1,73 @@
+/**
+ * @file TestProblem.hpp
+ * @copyright Released under the terms of the BSD 3-Clause License
+ * @date 2026
+ */
+
+#ifndef OSQPEIGEN_TEST_PROBLEM_HPP
+#define OSQPEIGEN_TEST_PROBLEM_HPP
+
+// Std
+#include <memory>
+#include <type_traits>
+
+// OsqpEigen
+#include <OsqpEigen/OsqpEigen.h>
+
+namespace OsqpEigenTest
+{
+/**
+ * Regularization of the KKT matrix used by the tests that update rho. In single precision the
+ * default one is below the resolution of the entries of the matrix, hence the factorization may
+ * fail when rho is updated.
+ */
+constexpr c_float sigma = std::is_same<c_float, float>::value ? 1e-4 : 1e-6;
+
+/**
+ * TestProblem struct contains the QP problem with two variables and three constraints shared by
+ * the tests. Its solution is (0.3, 0.7).
+ */
+struct TestProblem
+{
+    Eigen::SparseMatrix<c_float> hessian{2, 2}; /**< Hessian matrix. */
+    Eigen::SparseMatrix<c_float> linearConstraints{3, 2}; /**< Linear constraints matrix. */
+    Eigen::Matrix<c_float, 2, 1> gradient; /**< Gradient vector. */
+    Eigen::Matrix<c_float, 3, 1> lowerBound; /**< Lower bound vector. */
+    Eigen::Matrix<c_float, 3, 1> upperBound; /**< Upper bound vector. */
+
+    TestProblem()
+    {
+        hessian.insert(0, 0) = 4;
+        hessian.insert(0, 1) = 1;
+        hessian.insert(1, 0) = 1;
+        hessian.insert(1, 1) = 2;
+
+        linearConstraints.insert(0, 0) = 1;
+        linearConstraints.insert(0, 1) = 1;
+        linearConstraints.insert(1, 0) = 1;
+        linearConstraints.insert(2, 1) = 1;
+
+        gradient << 1, 1;
+        lowerBound << 1, 0, 0;
+        upperBound << 1, 0.7, 0.7;
+    }
+
+    /**
+     * Set the problem in a Data object.
+     * @param data is the Data object.
+     * @note the vectors are not copied unless Data::setVectorsCopy() is enabled, hence the problem
+     * has to outlive the Data object.
+     * @return true/false in case of success/failure.
+     */
+    bool setData(const std::unique_ptr<OsqpEigen::Data>& data)
+    {
+        data->setNumberOfVariables(2);
+        data->setNumberOfConstraints(3);
+        return data->setHessianMatrix(hessian) && data->setGradient(gradient)
+               && data->setLinearConstraintsMatrix(linearConstraints)
+               && data->setBounds(lowerBound, upperBound);
+    }
+};
+} // namespace OsqpEigenTest
+
+#endif
@@ -96,3 +96,275 @@ TEST_CASE("QPProblem - SparsityChange")
     std::cout << COUT_GTEST_MGT << "Solution [" << solution(0) << " " << solution(1) << "]"
               << ANSI_TXT_DFT << std::endl;
 };
+
+TEST_CASE("QPProblem - CachedSparsityPattern")
+{
+    // change the values of the hessian matrix and restore them. Since the sparsity pattern is
+    // preserved only the values are sent to the solver
+    H << 2, 1, 1, 3;
+    H_s = H.sparseView();
+    REQUIRE(solver.updateHessianMatrix(H_s));
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    H << 1, 1, 1, 2;
+    H_s = H.sparseView();
+    REQUIRE(solver.updateHessianMatrix(H_s));
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    Eigen::Matrix<c_float, -1, 1> solution = solver.getSolution();
+
+    // solve the same problem with a new solver
+    OsqpEigen::Solver otherSolver;
+    otherSolver.settings()->setVerbosity(false);
+    otherSolver.settings()->setScaling(0);
+    otherSolver.data()->setNumberOfVariables(2);
+    otherSolver.data()->setNumberOfConstraints(3);
+    REQUIRE(otherSolver.data()->setHessianMatrix(H_s));
+    REQUIRE(otherSolver.data()->setGradient(gradient));
+    REQUIRE(otherSolver.data()->setLinearConstraintsMatrix(A_s));
+    REQUIRE(otherSolver.data()->setLowerBound(lowerBound));
+    REQUIRE(otherSolver.data()->setUpperBound(upperBound));
+    REQUIRE(otherSolver.initSolver());
+    REQUIRE(otherSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    constexpr double tolerance = 1e-2;
+    REQUIRE((solution - otherSolver.getSolution()).norm() <= tolerance);
+}
+
+TEST_CASE("QPProblem - UpdateValues")
+{
+    // the values are stored in compressed-column order. Only the upper triangular part of the
+    // hessian matrix is considered
+    Eigen::Matrix<c_float, 3, 1> hessianValues;
+    hessianValues << 4, 1, 3;
+    Eigen::Matrix<c_float, 5, 1> linearConstraintsValues;
+    linearConstraintsValues << 1, 1, 2, 0.4, 1;
+
+    // the number of values has to match the number of non zeros
+    REQUIRE_FALSE(solver.updateHessianValues(linearConstraintsValues));
+    REQUIRE_FALSE(solver.updateLinearConstraintsValues(hessianValues));
+
+    REQUIRE(solver.updateHessianValues(hessianValues));
+    REQUIRE(solver.updateLinearConstraintsValues(linearConstraintsValues));
+    REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    Eigen::Matrix<c_float, -1, 1> solution = solver.getSolution();
+
+    // solve the same problem with a new solver
+    H << 4, 1, 1, 3;
+    H_s = H.sparseView();
+    A << 1, 2, 1, 0.4, 0, 1;
+    A_s = A.sparseView();
+
+    OsqpEigen::Solver otherSolver;
+    otherSolver.settings()->setVerbosity(false);
+    otherSolver.settings()->setScaling(0);
+    otherSolver.data()->setNumberOfVariables(2);
+    otherSolver.data()->setNumberOfConstraints(3);
+    REQUIRE(otherSolver.data()->setHessianMatrix(H_s));
+    REQUIRE(otherSolver.data()->setGradient(gradient));
+    REQUIRE(otherSolver.data()->setLinearConstraintsMatrix(A_s));
+    REQUIRE(otherSolver.data()->setLowerBound(lowerBound));
+    REQUIRE(otherSolver.data()->setUpperBound(upperBound));
+    REQUIRE(otherSolver.initSolver());
+    REQUIRE(otherSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    constexpr double tolerance = 1e-2;
+    REQUIRE((solution - otherSolver.getSolution()).norm() <= tolerance);
+
+    // the cached values are aligned, hence updating with the same matrices does not change them
+    REQUIRE(solver.updateHessianMatrix(H_s));
+    REQUIRE(solver.updateLinearConstraintsMatrix(A_s));
+}
+
+TEST_CASE("QPProblem - SparsityPatternSuperset")
+{
+    // the maximal sparsity pattern is declared storing explicit zeros
+    Eigen::SparseMatrix<c_float> hessianSuperset(2, 2);
+    hessianSuperset.insert(0, 0) = 4;
+    hessianSuperset.insert(0, 1) = 0;
+    hessianSuperset.insert(1, 0) = 0;
+    hessianSuperset.insert(1, 1) = 2;
+
+    Eigen::SparseMatrix<c_float> linearConstraintsSuperset(3, 2);
+    linearConstraintsSuperset.insert(0, 0) = 1;
+    linearConstraintsSuperset.insert(0, 1) = 1;
+    linearConstraintsSuperset.insert(1, 0) = 1;
+    linearConstraintsSuperset.insert(1, 1) = 0;
+    linearConstraintsSuperset.insert(2, 1) = 1;
+
+    OsqpEigen::Solver supersetSolver;
+    supersetSolver.settings()->setVerbosity(false);
+    supersetSolver.settings()->setScaling(0);
+    supersetSolver.setSparsityPatternSuperset(true);
+    supersetSolver.data()->setNumberOfVariables(2);
+    supersetSolver.data()->setNumberOfConstraints(3);
+    REQUIRE(supersetSolver.data()->setHessianMatrix(hessianSuperset));
+    REQUIRE(supersetSolver.data()->setGradient(gradient));
+    REQUIRE(supersetSolver.data()->setLinearConstraintsMatrix(linearConstraintsSuperset));
+    REQUIRE(supersetSolver.data()->setLowerBound(lowerBound));
+    REQUIRE(supersetSolver.data()->setUpperBound(upperBound));
+    REQUIRE(supersetSolver.initSolver());
+
+    // the sparsity patterns are contained in the maximal ones
+    H << 1, 1, 1, 2;
+    H_s = H.sparseView();
+    A << 1, 0, 1, 0.4, 0, 1;
+    A_s = A.sparseView();
+    REQUIRE(supersetSolver.updateHessianMatrix(H_s));
+    REQUIRE(supersetSolver.updateLinearConstraintsMatrix(A_s));
+
+    Eigen::SparseMatrix<c_float, Eigen::RowMajor> rowMajorHessian = H_s;
+    REQUIRE(supersetSolver.updateHessianMatrix(rowMajorHessian));
+
+    // the solver is not reinitialized, hence the matrix stored in Data keeps the explicit zero
+    REQUIRE(supersetSolver.data()->getData()->A->p[2] == 5);
+
+    REQUIRE(supersetSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+    Eigen::Matrix<c_float, -1, 1> solution = supersetSolver.getSolution();
+
+    // solve the same problem with a new solver
+    OsqpEigen::Solver otherSolver;
+    otherSolver.settings()->setVerbosity(false);
+    otherSolver.settings()->setScaling(0);
+    otherSolver.data()->setNumberOfVariables(2);
+    otherSolver.data()->setNumberOfConstraints(3);
+    REQUIRE(otherSolver.data()->setHessianMatrix(H_s));
+    REQUIRE(otherSolver.data()->setGradient(gradient));
+    REQUIRE(otherSolver.data()->setLinearConstraintsMatrix(A_s));
+    REQUIRE(otherSolver.data()->setLowerBound(lowerBound));
+    REQUIRE(otherSolver.data()->setUpperBound(upperBound));
+    REQUIRE(otherSolver.initSolver());
+    REQUIRE(otherSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    constexpr double tolerance = 1e-2;
+    REQUIRE((solution - otherSolver.getSolution()).norm() <= tolerance);
+
+    // an element outside the maximal sparsity pattern requires to reinitialize the solver
+    A << 1, 0, 1, 0.4, 1, 1;
+    A_s = A.sparseView();
+    REQUIRE(supersetSolver.updateLinearConstraintsMatrix(A_s));
+    REQUIRE(supersetSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+}
+
+TEST_CASE("QPProblem - RowMajorRestoreValues")
+{
+    // the elements of the matrices have the same order in row major and column major storage,
+    // hence the values are compared without reinitializing the solver
+    Eigen::Matrix<c_float, 2, 2> hessian;
+    hessian << 4, 1, 1, 2;
+    Eigen::SparseMatrix<c_float> hessianSparse = hessian.sparseView();
+    Eigen::Matrix<c_float, 2, 2> linearConstraints;
+    linearConstraints << 1, 0, 0, 1;
+    Eigen::SparseMatrix<c_float> linearConstraintsSparse = linearConstraints.sparseView();
+    Eigen::Matrix<c_float, 2, 1> q;
+    q << -1, -1;
+    Eigen::Matrix<c_float, 2, 1> l;
+    l << -10, -10;
+    Eigen::Matrix<c_float, 2, 1> u;
+    u << 0.1, 10;
+
+    OsqpEigen::Solver rowMajorSolver;
+    rowMajorSolver.settings()->setVerbosity(false);
+    rowMajorSolver.settings()->setAbsoluteTolerance(1e-6);
+    rowMajorSolver.settings()->setRelativeTolerance(1e-6);
+    rowMajorSolver.data()->setNumberOfVariables(2);
+    rowMajorSolver.data()->setNumberOfConstraints(2);
+    REQUIRE(rowMajorSolver.data()->setHessianMatrix(hessianSparse));
+    REQUIRE(rowMajorSolver.data()->setGradient(q));
+    REQUIRE(rowMajorSolver.data()->setLinearConstraintsMatrix(linearConstraintsSparse));
+    REQUIRE(rowMajorSolver.data()->setLowerBound(l));
+    REQUIRE(rowMajorSolver.data()->setUpperBound(u));
+    REQUIRE(rowMajorSolver.initSolver());
+
+    // the values are changed and then restored with row major matrices. The restored values
+    // differ from the ones currently stored in the solver, hence they have to be sent
+    Eigen::Matrix<c_float, 2, 2> otherHessian;
+    otherHessian << 1, 1, 1, 4;
+    Eigen::Matrix<c_float, 2, 2> otherLinearConstraints;
+    otherLinearConstraints << 2, 0, 0, 1;
+    Eigen::SparseMatrix<c_float, Eigen::RowMajor> rowMajorHessian = otherHessian.sparseView();
+    Eigen::SparseMatrix<c_float, Eigen::RowMajor> rowMajorLinearConstraints
+        = otherLinearConstraints.sparseView();
+    REQUIRE(rowMajorSolver.updateHessianMatrix(rowMajorHessian));
+    REQUIRE(rowMajorSolver.updateLinearConstraintsMatrix(rowMajorLinearConstraints));
+    REQUIRE(rowMajorSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    constexpr double tolerance = 1e-3;
+    Eigen::Matrix<c_float, 2, 1> expectedSolution;
+    expectedSolution << 0.05, 0.2375;
+    REQUIRE((rowMajorSolver.getSolution() - expectedSolution).norm() <= tolerance);
+
+    rowMajorHessian = hessianSparse;
+    rowMajorLinearConstraints = linearConstraintsSparse;
+    REQUIRE(rowMajorSolver.updateHessianMatrix(rowMajorHessian));
+    REQUIRE(rowMajorSolver.updateLinearConstraintsMatrix(rowMajorLinearConstraints));
+    REQUIRE(rowMajorSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+    expectedSolution << 0.1, 0.45;
+    REQUIRE((rowMajorSolver.getSolution() - expectedSolution).norm() <= tolerance);
+}
+
+TEST_CASE("QPProblem - BlockUpdate")
+{
+    // the linear constraints matrices are blocks of larger matrices, hence their outer indices do
+    // not start from zero
+    Eigen::Matrix<c_float, 3, 4> columns;
+    columns << 5, 0, 1, 1, 0, 6, 1, 0, 7, 0, 0, 1;
+    Eigen::SparseMatrix<c_float> columnsSparse = columns.sparseView();
+    Eigen::Matrix<c_float, 5, 2> rows;
+    rows << 5, 6, 0, 7, 2, 1, 1, 0, 0, 1;
+    Eigen::SparseMatrix<c_float, Eigen::RowMajor> rowsSparse = rows.sparseView();
+    Eigen::Matrix<c_float, 3, 4> otherColumns;
+    otherColumns << 5, 0, 1, 1, 0, 6, 1, 1, 7, 0, 0, 1;
+    Eigen::SparseMatrix<c_float> otherColumnsSparse = otherColumns.sparseView();
+
+    Eigen::Matrix<c_float, 2, 2> hessian;
+    hessian << 4, 1, 1, 2;
+    Eigen::SparseMatrix<c_float> hessianSparse = hessian.sparseView();
+    Eigen::Matrix<c_float, 2, 1> q;
+    q << 1, 1;
+    Eigen::Matrix<c_float, 3, 1> l;
+    l << 1, 0, 0;
+    Eigen::Matrix<c_float, 3, 1> u;
+    u << 1, 0.7, 0.7;
+
+    const auto initSolver = [&](OsqpEigen::Solver& solver, const auto& linearConstraints) {
+        solver.settings()->setVerbosity(false);
+        solver.settings()->setAbsoluteTolerance(1e-6);
+        solver.settings()->setRelativeTolerance(1e-6);
+        solver.data()->setNumberOfVariables(2);
+        solver.data()->setNumberOfConstraints(3);
+        REQUIRE(solver.data()->setHessianMatrix(hessianSparse));
+        REQUIRE(solver.data()->setGradient(q));
+        REQUIRE(solver.data()->setLinearConstraintsMatrix(linearConstraints));
+        REQUIRE(solver.data()->setBounds(l, u));
+        REQUIRE(solver.initSolver());
+    };
+
+    // the solution of the block problem is the one of the same problem with a full matrix
+    const auto requireSolution = [&](OsqpEigen::Solver& solver,
+                                     const Eigen::Matrix<c_float, 3, 2>& linearConstraints) {
+        Eigen::SparseMatrix<c_float> linearConstraintsSparse = linearConstraints.sparseView();
+        OsqpEigen::Solver fullSolver;
+        initSolver(fullSolver, linearConstraintsSparse);
+        REQUIRE(fullSolver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+        REQUIRE(solver.solveProblem() == OsqpEigen::ErrorExitFlag::NoError);
+
+        constexpr double tolerance = 1e-3;
+        REQUIRE((solver.getSolution() - fullSolver.getSolution()).norm() <= tolerance);
+    };
+
+    OsqpEigen::Solver solver;
+    initSolver(solver, columnsSparse.middleCols(2, 2));
+    requireSolution(solver, columns.middleCols(2, 2));
+
+    // the row major block is compared with the cached matrix through its triplets
+    REQUIRE(solver.updateLinearConstraintsMatrix(rowsSparse.middleRows(2, 3)));
+    requireSolution(solver, rows.middleRows(2, 3));
+
+    // the column major block is compared with the cached sparsity pattern, a new element
+    // requires to initialize the solver again with the block
+    REQUIRE(solver.updateLinearConstraintsMatrix(columnsSparse.middleCols(2, 2)));
+    requireSolution(solver, columns.middleCols(2, 2));
+    REQUIRE(solver.updateLinearConstraintsMatrix(otherColumnsSparse.middleCols(2, 2)));
+    requireSolution(solver, otherColumns.middleCols(2, 2));
+}